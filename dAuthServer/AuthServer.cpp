@@ -51,6 +51,8 @@ int main(int argc, char** argv) {
 	Game::config = new dConfig("authconfig.ini");
 
 	//Create all the objects we need to run our service:
+	// Writes out everything logged before any return from main, including the early ones on failure
+	const Server::LoggerGuard loggerGuard;
 	Server::SetupLogger("AuthServer");
 	if (!Game::logger) return EXIT_FAILURE;
 
@@ -64,7 +66,6 @@ int main(int argc, char** argv) {
 		LOG("Got an error while connecting to the database: %s", ex.what());
 		Database::Destroy("AuthServer");
 		delete Game::server;
-		delete Game::logger;
 		return EXIT_FAILURE;
 	}
 
@@ -93,7 +94,7 @@ int main(int argc, char** argv) {
 	Game::server = new dServer(ourIP, ourPort, 0, maxClients, false, true, Game::logger, masterIP, masterPort, ServerType::Auth, Game::config, &Game::lastSignal);
 
 	//Run it until server gets a kill message from Master:
-	auto t = std::chrono::high_resolution_clock::now();
+	auto t = std::chrono::steady_clock::now();
 	Packet* packet = nullptr;
 	constexpr uint32_t logFlushTime = 30 * authFramerate; // 30 seconds in frames
 	constexpr uint32_t sqlPingTime = 10 * 60 * authFramerate; // 10 minutes in frames
@@ -102,60 +103,65 @@ int main(int argc, char** argv) {
 	uint32_t framesSinceLastSQLPing = 0;
 
 	AuthPackets::LoadClaimCodes();
+	AuthPackets::StartLoginWorkers(Game::server);
 	
 	Game::logger->Flush(); // once immediately before main loop
 	while (!Game::ShouldShutdown()) {
-		//Check if we're still connected to master:
-		if (!Game::server->GetIsConnectedToMaster()) {
-			framesSinceMasterDisconnect++;
-
-			if (framesSinceMasterDisconnect >= authFramerate) {
-				LOG("No connection to master!");
-				break; //Exit our loop, shut down.
-			}
-		} else framesSinceMasterDisconnect = 0;
-
-		//In world we'd update our other systems here.
-
-		//Check for packets here:
-		Game::server->ReceiveFromMaster(); //ReceiveFromMaster also handles the master packets if needed.
-		packet = Game::server->Receive();
-		if (packet) {
+		//Check for packets here, handling everything that arrived since we last woke up:
+		Game::server->ReceiveAllFromMaster();
+		while ((packet = Game::server->Receive())) {
 			HandlePacket(packet);
 			Game::server->DeallocatePacket(packet);
-			packet = nullptr;
 		}
 
-		//Push our log every 30s:
-		if (framesSinceLastFlush >= logFlushTime) {
-			Game::logger->Flush();
-			framesSinceLastFlush = 0;
-		} else framesSinceLastFlush++;
-
-		//Every 10 min we ping our sql server to keep it alive hopefully:
-		if (framesSinceLastSQLPing >= sqlPingTime) {
-			//Find out the master's IP for absolutely no reason:
-			std::string masterIP;
-			uint32_t masterPort;
-			auto masterInfo = Database::Get()->GetMasterInfo();
-			if (masterInfo) {
-				masterIP = masterInfo->ip;
-				masterPort = masterInfo->port;
-			}
-
-			framesSinceLastSQLPing = 0;
-		} else framesSinceLastSQLPing++;
+		//Finish any logins whose password check is done:
+		AuthPackets::ProcessCompletedLogins();
+
+		//Everything else still runs once per frame:
+		if (std::chrono::steady_clock::now() >= t) {
+			t += std::chrono::milliseconds(authFrameDelta); //Auth can run at a lower "fps"
+
+			//Check if we're still connected to master:
+			if (!Game::server->GetIsConnectedToMaster()) {
+				framesSinceMasterDisconnect++;
+
+				if (framesSinceMasterDisconnect >= authFramerate) {
+					LOG("No connection to master!");
+					break; //Exit our loop, shut down.
+				}
+			} else framesSinceMasterDisconnect = 0;
+
+			//Push our log every 30s:
+			if (framesSinceLastFlush >= logFlushTime) {
+				AuthPackets::LogLoginMetrics();
+				Game::logger->Flush();
+				framesSinceLastFlush = 0;
+			} else framesSinceLastFlush++;
+
+			//Every 10 min we ping our sql server to keep it alive hopefully:
+			if (framesSinceLastSQLPing >= sqlPingTime) {
+				//Find out the master's IP for absolutely no reason:
+				std::string masterIP;
+				uint32_t masterPort;
+				auto masterInfo = Database::Get()->GetMasterInfo();
+				if (masterInfo) {
+					masterIP = masterInfo->ip;
+					masterPort = masterInfo->port;
+				}
+
+				framesSinceLastSQLPing = 0;
+			} else framesSinceLastSQLPing++;
+		}
 
-		//Sleep our thread since auth can afford to.
-		t += std::chrono::milliseconds(authFrameDelta); //Auth can run at a lower "fps"
-		std::this_thread::sleep_until(t);
+		//Sleep until the next frame, or until a packet arrives.
+		Game::server->WaitForPackets(t);
 	}
 
 	LOG("Exited Main Loop! (signal %d)", Game::lastSignal);
+	AuthPackets::StopLoginWorkers();
 	//Delete our objects here:
 	Database::Destroy("AuthServer");
 	delete Game::server;
-	delete Game::logger;
 	delete Game::config;
 
 	return EXIT_SUCCESS;
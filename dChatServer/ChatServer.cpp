@@ -54,6 +54,8 @@ int main(int argc, char** argv) {
 	Game::config = new dConfig("chatconfig.ini");
 
 	//Create all the objects we need to run our service:
+	// Writes out everything logged before any return from main, including the early ones on failure
+	const Server::LoggerGuard loggerGuard;
 	Server::SetupLogger("ChatServer");
 	if (!Game::logger) return EXIT_FAILURE;
 
@@ -85,7 +87,6 @@ int main(int argc, char** argv) {
 		LOG("Got an error while connecting to the database: %s", ex.what());
 		Database::Destroy("ChatServer");
 		delete Game::server;
-		delete Game::logger;
 		return EXIT_FAILURE;
 	}
 
@@ -114,7 +115,7 @@ int main(int argc, char** argv) {
 	Game::playerContainer.Initialize();
 
 	//Run it until server gets a kill message from Master:
-	auto t = std::chrono::high_resolution_clock::now();
+	auto t = std::chrono::steady_clock::now();
 	Packet* packet = nullptr;
 	constexpr uint32_t logFlushTime = 30 * chatFramerate; // 30 seconds in frames
 	constexpr uint32_t sqlPingTime = 10 * 60 * chatFramerate; // 10 minutes in frames
@@ -124,55 +125,54 @@ int main(int argc, char** argv) {
 
 	Game::logger->Flush(); // once immediately before main loop
 	while (!Game::ShouldShutdown()) {
-		//Check if we're still connected to master:
-		if (!Game::server->GetIsConnectedToMaster()) {
-			framesSinceMasterDisconnect++;
-
-			if (framesSinceMasterDisconnect >= chatFramerate)
-				break; //Exit our loop, shut down.
-		} else framesSinceMasterDisconnect = 0;
-
-		//In world we'd update our other systems here.
-
-		//Check for packets here:
-		Game::server->ReceiveFromMaster(); //ReceiveFromMaster also handles the master packets if needed.
-		packet = Game::server->Receive();
-		if (packet) {
+		//Check for packets here, handling everything that arrived since we last woke up:
+		Game::server->ReceiveAllFromMaster();
+		while ((packet = Game::server->Receive())) {
 			HandlePacket(packet);
 			Game::server->DeallocatePacket(packet);
-			packet = nullptr;
 		}
 
-		//Push our log every 30s:
-		if (framesSinceLastFlush >= logFlushTime) {
-			Game::logger->Flush();
-			framesSinceLastFlush = 0;
-		} else framesSinceLastFlush++;
-
-		//Every 10 min we ping our sql server to keep it alive hopefully:
-		if (framesSinceLastSQLPing >= sqlPingTime) {
-			//Find out the master's IP for absolutely no reason:
-			std::string masterIP;
-			uint32_t masterPort;
-
-			auto masterInfo = Database::Get()->GetMasterInfo();
-			if (masterInfo) {
-				masterIP = masterInfo->ip;
-				masterPort = masterInfo->port;
-			}
-
-			framesSinceLastSQLPing = 0;
-		} else framesSinceLastSQLPing++;
+		//Everything else still runs once per frame:
+		if (std::chrono::steady_clock::now() >= t) {
+			t += std::chrono::milliseconds(chatFrameDelta); //Chat can run at a lower "fps"
+
+			//Check if we're still connected to master:
+			if (!Game::server->GetIsConnectedToMaster()) {
+				framesSinceMasterDisconnect++;
+
+				if (framesSinceMasterDisconnect >= chatFramerate)
+					break; //Exit our loop, shut down.
+			} else framesSinceMasterDisconnect = 0;
+
+			//Push our log every 30s:
+			if (framesSinceLastFlush >= logFlushTime) {
+				Game::logger->Flush();
+				framesSinceLastFlush = 0;
+			} else framesSinceLastFlush++;
+
+			//Every 10 min we ping our sql server to keep it alive hopefully:
+			if (framesSinceLastSQLPing >= sqlPingTime) {
+				//Find out the master's IP for absolutely no reason:
+				std::string masterIP;
+				uint32_t masterPort;
+
+				auto masterInfo = Database::Get()->GetMasterInfo();
+				if (masterInfo) {
+					masterIP = masterInfo->ip;
+					masterPort = masterInfo->port;
+				}
+
+				framesSinceLastSQLPing = 0;
+			} else framesSinceLastSQLPing++;
+		}
 
-		//Sleep our thread since auth can afford to.
-		t += std::chrono::milliseconds(chatFrameDelta); //Chat can run at a lower "fps"
-		std::this_thread::sleep_until(t);
+		//Sleep until the next frame, or until a packet arrives.
+		Game::server->WaitForPackets(t);
 	}
 
 	//Delete our objects here:
 	Database::Destroy("ChatServer");
 	delete Game::server;
-	delete Game::logger;
 	delete Game::config;
 
 	return EXIT_SUCCESS;
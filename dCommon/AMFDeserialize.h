@@ -2,10 +2,9 @@
 
 #include "BitStream.h"
 
-#include <vector>
-#include <string>
-
+class AMFArena;
 class AMFBaseValue;
+class AMFReader;
 
 class AMFDeserialize {
 public:
@@ -16,57 +15,34 @@ public:
 	 * @return Returns an AMFValue with all the information from the bitStream in it.
 	 */
 	AMFBaseValue* Read(RakNet::BitStream& inStream);
-private:
-	/**
-	 * @brief Private method to read a U29 integer from a bitstream
-	 *
-	 * @param inStream bitstream to read data from
-	 * @return The number as an unsigned 29 bit integer
-	 */
-	static uint32_t ReadU29(RakNet::BitStream& inStream);
 
 	/**
-	 * @brief Reads a string from a bitstream
+	 * Read an AMF3 value from a bitstream into an arena.
 	 *
-	 * @param inStream bitStream to read data from
-	 * @return The read string
+	 * @param inStream inStream to read value from.
+	 * @param arena The arena to create the values in, it owns the returned value.
+	 * @return Returns an AMFValue with all the information from the bitStream in it.
 	 */
-	const std::string ReadString(RakNet::BitStream& inStream);
-
+	AMFBaseValue* Read(RakNet::BitStream& inStream, AMFArena& arena);
+private:
 	/**
-	 * @brief Read an AMFDouble value from a bitStream
+	 * @brief Reads the next value from a reader
 	 *
-	 * @param inStream bitStream to read data from
-	 * @return Double value represented as an AMFValue
+	 * @param reader The reader to read the value from
+	 * @param arena The arena to create the value in, or nullptr to allocate it on its own
+	 * @return The value read
 	 */
-	AMFBaseValue* ReadAmfDouble(RakNet::BitStream& inStream);
+	AMFBaseValue* Read(AMFReader& reader, AMFArena* const arena);
 
 	/**
-	 * @brief Read an AMFArray from a bitStream
+	 * @brief Read an AMFArray from a reader
 	 *
-	 * @param inStream bitStream to read data from
+	 * @param reader The reader to read the array from
+	 * @param arena The arena to create the array in, or nullptr to allocate it on its own
 	 * @return Array value represented as an AMFValue
 	 */
-	AMFBaseValue* ReadAmfArray(RakNet::BitStream& inStream);
+	AMFBaseValue* ReadAmfArray(AMFReader& reader, AMFArena* const arena);
 
-	/**
-	 * @brief Read an AMFString from a bitStream
-	 *
-	 * @param inStream bitStream to read data from
-	 * @return String value represented as an AMFValue
-	 */
-	AMFBaseValue* ReadAmfString(RakNet::BitStream& inStream);
-
-	/**
-	 * @brief Read an AMFInteger from a bitStream
-	 *
-	 * @param inStream bitStream to read data from
-	 * @return Integer value represented as an AMFValue
-	 */
-	AMFBaseValue* ReadAmfInteger(RakNet::BitStream& inStream);
-
-	/**
-	 * List of strings read so far saved to be read by reference.
-	 */
-	std::vector<std::string> accessedElements;
+	template <typename AmfType, typename... Args>
+	static AmfType* Create(AMFArena* const arena, Args&&... args);
 };
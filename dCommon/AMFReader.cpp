@@ -0,0 +1,120 @@
+#include "AMFReader.h"
+
+#include <stdexcept>
+
+#include "Amf3.h"
+
+eAmf AMFReader::ReadMarker() {
+	eAmf marker = eAmf::Undefined;
+	if (!m_InStream.Read(marker)) throw std::out_of_range("AMF3 value is cut off");
+
+	switch (marker) {
+	case eAmf::Undefined:
+	case eAmf::Null:
+	case eAmf::False:
+	case eAmf::True:
+	case eAmf::Integer:
+	case eAmf::Double:
+	case eAmf::String:
+	case eAmf::Array:
+		return marker;
+
+	// These values are unimplemented in the live client and will remain unimplemented
+	// unless someone modifies the client to allow serializing of these values.
+	case eAmf::XMLDoc:
+	case eAmf::Date:
+	case eAmf::Object:
+	case eAmf::XML:
+	case eAmf::ByteArray:
+	case eAmf::VectorInt:
+	case eAmf::VectorUInt:
+	case eAmf::VectorDouble:
+	case eAmf::VectorObject:
+	case eAmf::Dictionary:
+		throw marker;
+	default:
+		throw std::invalid_argument("Invalid AMF3 marker" + std::to_string(static_cast<int32_t>(marker)));
+	}
+}
+
+uint32_t AMFReader::ReadU29() {
+	bool byteFlag = true;
+	uint32_t actualNumber{};
+	uint8_t numberOfBytesRead{};
+	while (byteFlag && numberOfBytesRead < 4) {
+		uint8_t byte{};
+		m_InStream.Read(byte);
+		// Parse the byte
+		if (numberOfBytesRead < 3) {
+			byteFlag = byte & static_cast<uint8_t>(1 << 7);
+			byte = byte << 1UL;
+		}
+		// Combine the read byte with our current read in number
+		actualNumber <<= 8UL;
+		actualNumber |= static_cast<uint32_t>(byte);
+		// If we are not done reading in bytes, shift right 1 bit
+		if (numberOfBytesRead < 3) actualNumber = actualNumber >> 1UL;
+		numberOfBytesRead++;
+	}
+	return actualNumber;
+}
+
+double AMFReader::ReadDouble() {
+	double value{};
+	m_InStream.Read<double>(value);
+	return value;
+}
+
+std::string_view AMFReader::ReadString() {
+	auto length = ReadU29();
+	// Check if this is a reference
+	bool isReference = length % 2 == 1;
+	// Right shift by 1 bit to get index if reference or size of next string if value
+	length = length >> 1;
+	if (!isReference) {
+		// Length is a reference to a previous index - use that as the read in value
+		return m_Strings.at(length);
+	}
+
+	if (static_cast<uint64_t>(length) * 8 > m_InStream.GetNumberOfUnreadBits()) throw std::out_of_range("AMF3 string is cut off");
+
+	std::string_view value;
+	if (m_InStream.GetReadOffset() % 8 == 0) {
+		value = std::string_view(reinterpret_cast<const char*>(m_InStream.GetData()) + m_InStream.GetReadOffset() / 8, length);
+		m_InStream.IgnoreBytes(length);
+	} else {
+		auto& copy = m_UnalignedStrings.emplace_back(length, '\0');
+		m_InStream.Read(copy.data(), length);
+		value = copy;
+	}
+
+	// Empty strings are never sent by reference
+	if (!value.empty()) m_Strings.push_back(value);
+	return value;
+}
+
+uint32_t AMFReader::ReadArrayStart() {
+	return ReadU29() >> 1;
+}
+
+void AMFReader::Skip(const eAmf marker) {
+	switch (marker) {
+	case eAmf::Integer:
+		ReadU29();
+		break;
+	case eAmf::Double:
+		ReadDouble();
+		break;
+	case eAmf::String:
+		ReadString();
+		break;
+	case eAmf::Array: {
+		const auto denseSize = ReadArrayStart();
+		while (!ReadKey().empty()) Skip(ReadMarker());
+		for (uint32_t i = 0; i < denseSize; i++) Skip(ReadMarker());
+		break;
+	}
+	default:
+		break;
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "BitStream.h"
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class eAmf : uint8_t;
+
+/**
+ * Reads AMF3 values from a bitstream one piece at a time without building values for them.
+ * Strings are returned as views into the bitstream, they are valid as long as both the bitstream and the reader are.
+ *
+ * An array is read by ReadArrayStart, followed by ReadKey and a value until ReadKey returns an empty key,
+ * followed by the number of dense values ReadArrayStart returned.
+ */
+class AMFReader {
+public:
+	explicit AMFReader(RakNet::BitStream& inStream) : m_InStream{ inStream } {};
+
+	/**
+	 * @return The marker of the next value
+	 */
+	eAmf ReadMarker();
+
+	/**
+	 * @brief Reads a U29 integer
+	 *
+	 * @return The number as an unsigned 29 bit integer
+	 */
+	uint32_t ReadU29();
+
+	double ReadDouble();
+
+	/**
+	 * @brief Reads a string or a reference to a string read before
+	 *
+	 * @return A view of the string
+	 */
+	std::string_view ReadString();
+
+	/**
+	 * @brief Reads the header of an array
+	 *
+	 * @return The number of values in the dense portion of the array
+	 */
+	uint32_t ReadArrayStart();
+
+	/**
+	 * @return The key of the next associative value, an empty key ends the associative portion
+	 */
+	std::string_view ReadKey() { return ReadString(); }
+
+	/**
+	 * @brief Skips the value with the given marker, including every value in it
+	 */
+	void Skip(const eAmf marker);
+
+private:
+	RakNet::BitStream& m_InStream;
+
+	/**
+	 * Strings read so far, saved to be read by reference.
+	 */
+	std::vector<std::string_view> m_Strings;
+
+	/**
+	 * Copies of the strings that did not start on a byte boundary and could not be viewed in place.
+	 */
+	std::deque<std::string> m_UnalignedStrings;
+};
@@ -5,6 +5,9 @@
 #include "Logger.h"
 #include "Game.h"
 
+#include <cstddef>
+#include <memory>
+#include <new>
 #include <unordered_map>
 #include <vector>
 
@@ -96,6 +99,62 @@ using AMFIntValue = AMFValue<int32_t>;
 using AMFStringValue = AMFValue<std::string>;
 using AMFDoubleValue = AMFValue<double>;
 
+/**
+ * Allocates AMF values back to back in large blocks and destroys all of them at once.
+ * Arrays created in an arena create their elements in the same arena, so a whole tree
+ * costs a few block allocations instead of one allocation per value.
+ *
+ * Values created in an arena are owned by it and are never to be deleted by a caller.
+ */
+class AMFArena {
+public:
+	AMFArena() = default;
+	~AMFArena() { Reset(); }
+
+	AMFArena(const AMFArena&) = delete;
+	AMFArena& operator=(const AMFArena&) = delete;
+
+	template <typename AmfType, typename... Args>
+	[[nodiscard]] AmfType* Create(Args&&... args) {
+		auto* const value = new (Allocate(sizeof(AmfType), alignof(AmfType))) AmfType(std::forward<Args>(args)...);
+		m_Values.push_back(value);
+		return value;
+	}
+
+	/**
+	 * Destroys every value in the arena, the blocks are kept for the next values.
+	 */
+	void Reset() {
+		for (auto it = m_Values.rbegin(); it != m_Values.rend(); ++it) (*it)->~AMFBaseValue();
+		m_Values.clear();
+		m_Block = 0;
+		m_Offset = 0;
+	}
+
+private:
+	static constexpr size_t BlockSize = 16 * 1024;
+
+	void* Allocate(const size_t size, const size_t alignment) {
+		while (true) {
+			if (m_Block == m_Blocks.size()) m_Blocks.push_back(std::make_unique<std::byte[]>(BlockSize));
+
+			const size_t offset = (m_Offset + alignment - 1) & ~(alignment - 1);
+			if (offset + size <= BlockSize) {
+				m_Offset = offset + size;
+				return m_Blocks[m_Block].get() + offset;
+			}
+
+			m_Block++;
+			m_Offset = 0;
+		}
+	}
+
+	std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+	size_t m_Block = 0;
+	size_t m_Offset = 0;
+	std::vector<AMFBaseValue*> m_Values;
+};
+
 /**
  * The AMFArrayValue object holds 2 types of lists:
  * An associative list where a key maps to a value
@@ -103,15 +162,23 @@ using AMFDoubleValue = AMFValue<double>;
  *
  * Objects that are Registered are owned by this object
  * and are not to be deleted by a caller.
+ *
+ * An array created with an arena creates its elements in that arena and leaves
+ * freeing them to the arena.
  */
 class AMFArrayValue : public AMFBaseValue {
 	using AMFAssociative = std::unordered_map<std::string, AMFBaseValue*>;
 	using AMFDense = std::vector<AMFBaseValue*>;
 
 public:
+	AMFArrayValue() = default;
+	explicit AMFArrayValue(AMFArena& arena) : m_Arena{ &arena } {}
+
 	[[nodiscard]] constexpr eAmf GetValueType() const noexcept override { return eAmf::Array; }
 
 	~AMFArrayValue() override {
+		if (m_Arena) return;
+
 		for (const auto* valueToDelete : GetDense()) {
 			if (valueToDelete) {
 				delete valueToDelete;
@@ -156,7 +223,7 @@ public:
 		AMFValue<ValueType>* val = nullptr;
 		bool found = true;
 		if (element == m_Associative.cend()) {
-			val = new AMFValue<ValueType>(value);
+			val = NewValue<AMFValue<ValueType>>(value);
 			m_Associative.emplace(key, val);
 		} else {
 			val = dynamic_cast<AMFValue<ValueType>*>(element->second);
@@ -171,7 +238,7 @@ public:
 		AMFArrayValue* val = nullptr;
 		bool found = true;
 		if (element == m_Associative.cend()) {
-			val = new AMFArrayValue();
+			val = NewArray();
 			m_Associative.emplace(key, val);
 		} else {
 			val = dynamic_cast<AMFArrayValue*>(element->second);
@@ -186,7 +253,7 @@ public:
 		bool inserted = false;
 		if (index >= m_Dense.size()) {
 			m_Dense.resize(index + 1);
-			val = new AMFArrayValue();
+			val = NewArray();
 			m_Dense.at(index) = val;
 			inserted = true;
 		}
@@ -209,7 +276,7 @@ public:
 		bool inserted = false;
 		if (index >= m_Dense.size()) {
 			m_Dense.resize(index + 1);
-			val = new AMFValue<ValueType>(value);
+			val = NewValue<AMFValue<ValueType>>(value);
 			m_Dense.at(index) = val;
 			inserted = true;
 		}
@@ -228,7 +295,7 @@ public:
 	void Insert(const std::string& key, AMFBaseValue* const value) {
 		const auto element = m_Associative.find(key);
 		if (element != m_Associative.cend() && element->second) {
-			delete element->second;
+			DeleteValue(element->second);
 			element->second = value;
 		} else {
 			m_Associative.emplace(key, value);
@@ -247,7 +314,7 @@ public:
 	void Insert(const size_t index, AMFBaseValue* const value) {
 		if (index < m_Dense.size()) {
 			const AMFDense::const_iterator itr = m_Dense.cbegin() + index;
-			if (*itr) delete m_Dense.at(index);
+			if (*itr) DeleteValue(m_Dense.at(index));
 		} else {
 			m_Dense.resize(index + 1);
 		}
@@ -279,7 +346,7 @@ public:
 	void Remove(const std::string& key, const bool deleteValue = true) {
 		const AMFAssociative::const_iterator it = m_Associative.find(key);
 		if (it != m_Associative.cend()) {
-			if (deleteValue) delete it->second;
+			if (deleteValue) DeleteValue(it->second);
 			m_Associative.erase(it);
 		}
 	}
@@ -290,7 +357,7 @@ public:
 	void Remove(const size_t index) {
 		if (!m_Dense.empty() && index < m_Dense.size()) {
 			const auto itr = m_Dense.cbegin() + index;
-			if (*itr) delete (*itr);
+			if (*itr) DeleteValue(*itr);
 			m_Dense.erase(itr);
 		}
 	}
@@ -365,6 +432,20 @@ public:
 	}
 
 private:
+	template <typename AmfType, typename... Args>
+	AmfType* NewValue(Args&&... args) {
+		return m_Arena ? m_Arena->Create<AmfType>(std::forward<Args>(args)...) : new AmfType(std::forward<Args>(args)...);
+	}
+
+	AMFArrayValue* NewArray() {
+		return m_Arena ? m_Arena->Create<AMFArrayValue>(*m_Arena) : new AMFArrayValue();
+	}
+
+	// Values of an arena are freed by the arena
+	void DeleteValue(const AMFBaseValue* const value) {
+		if (!m_Arena) delete value;
+	}
+
 	/**
 	 * The associative portion.  These values are key'd with strings to an AMFValue.
 	 */
@@ -375,6 +456,11 @@ private:
 	 * another with the most recent addition being at the back.
 	 */
 	AMFDense m_Dense;
+
+	/**
+	 * The arena the elements of this array are created in, nullptr if they are allocated one by one.
+	 */
+	AMFArena* m_Arena = nullptr;
 };
 
 #endif  //!__AMF3__H__
@@ -0,0 +1,143 @@
+#include "CharacterSections.h"
+
+#include <cstring>
+#include <ranges>
+
+#include "tinyxml2.h"
+
+#include "ZCompression.h"
+
+namespace {
+	// magic + version + uncompressed size
+	constexpr size_t HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint32_t);
+
+	// The most zlib can shrink data by
+	constexpr size_t MAX_COMPRESSION_RATIO = 1032;
+
+	struct ParsedSection {
+		tinyxml2::XMLDocument doc;
+		// The next element of the section to place in the joined document
+		const tinyxml2::XMLElement* next = nullptr;
+	};
+}
+
+CharacterSections::SectionMap CharacterSections::Split(const tinyxml2::XMLDocument& doc) {
+	SectionMap sections;
+
+	const auto* obj = doc.FirstChildElement("obj");
+	if (!obj) return sections;
+
+	// The attributes of the root element and a placeholder for each child, the children are stored in their own sections.
+	tinyxml2::XMLPrinter rootPrinter(0, true, 0);
+	rootPrinter.OpenElement("obj", true);
+	for (const auto* attribute = obj->FirstAttribute(); attribute; attribute = attribute->Next()) {
+		rootPrinter.PushAttribute(attribute->Name(), attribute->Value());
+	}
+
+	for (const auto* child = obj->FirstChildElement(); child; child = child->NextSiblingElement()) {
+		rootPrinter.OpenElement(child->Name(), true);
+		rootPrinter.CloseElement(true);
+
+		tinyxml2::XMLPrinter printer(0, true, 0);
+		child->Accept(&printer);
+		sections[child->Name()] += printer.CStr();
+	}
+
+	rootPrinter.CloseElement(true);
+	sections[std::string(ROOT_SECTION)] = rootPrinter.CStr();
+
+	return sections;
+}
+
+std::string CharacterSections::Join(const SectionMap& sections) {
+	tinyxml2::XMLDocument doc;
+
+	const auto rootIt = sections.find(std::string(ROOT_SECTION));
+	if (rootIt != sections.end()) doc.Parse(rootIt->second.c_str(), rootIt->second.size());
+
+	auto* obj = doc.FirstChildElement("obj");
+	if (!obj) {
+		obj = doc.NewElement("obj");
+		doc.LinkEndChild(obj);
+	}
+
+	std::map<std::string_view, ParsedSection> parsed;
+	for (const auto& [name, xml] : sections) {
+		if (name == ROOT_SECTION) continue;
+
+		auto& section = parsed[name];
+		if (section.doc.Parse(xml.c_str(), xml.size()) == tinyxml2::XML_SUCCESS) section.next = section.doc.FirstChildElement();
+	}
+
+	// Replace every placeholder with the next element of its section
+	auto* placeholder = obj->FirstChildElement();
+	while (placeholder) {
+		auto* nextPlaceholder = placeholder->NextSiblingElement();
+
+		const auto it = parsed.find(placeholder->Name());
+		if (it != parsed.end() && it->second.next) {
+			obj->InsertAfterChild(placeholder, it->second.next->DeepClone(&doc));
+			it->second.next = it->second.next->NextSiblingElement();
+		}
+
+		obj->DeleteChild(placeholder);
+		placeholder = nextPlaceholder;
+	}
+
+	// Elements without a placeholder go at the end
+	for (auto& section : parsed | std::views::values) {
+		for (; section.next; section.next = section.next->NextSiblingElement()) {
+			obj->LinkEndChild(section.next->DeepClone(&doc));
+		}
+	}
+
+	tinyxml2::XMLPrinter printer(0, true, 0);
+	doc.Print(&printer);
+	return printer.CStr();
+}
+
+std::optional<std::string> CharacterSections::Encode(const std::string_view sectionXml) {
+	if (sectionXml.size() > MAX_SECTION_SIZE) return std::nullopt;
+
+	const auto uncompressedSize = static_cast<uint32_t>(sectionXml.size());
+	const auto maxCompressedSize = ZCompression::GetMaxCompressedLength(uncompressedSize);
+
+	std::string data(HEADER_SIZE + maxCompressedSize, '\0');
+	std::memcpy(data.data(), &MAGIC, sizeof(MAGIC));
+	data[sizeof(MAGIC)] = FORMAT_VERSION;
+	std::memcpy(data.data() + sizeof(MAGIC) + sizeof(FORMAT_VERSION), &uncompressedSize, sizeof(uncompressedSize));
+
+	const auto compressedSize = ZCompression::Compress(
+		reinterpret_cast<const uint8_t*>(sectionXml.data()), uncompressedSize,
+		reinterpret_cast<uint8_t*>(data.data() + HEADER_SIZE), maxCompressedSize);
+
+	if (compressedSize <= 0) return std::nullopt;
+
+	data.resize(HEADER_SIZE + compressedSize);
+	return data;
+}
+
+std::optional<std::string> CharacterSections::Decode(const std::string_view data) {
+	if (data.size() < HEADER_SIZE) return std::nullopt;
+
+	uint32_t magic{};
+	std::memcpy(&magic, data.data(), sizeof(magic));
+	if (magic != MAGIC || static_cast<uint8_t>(data[sizeof(MAGIC)]) != FORMAT_VERSION) return std::nullopt;
+
+	uint32_t uncompressedSize{};
+	std::memcpy(&uncompressedSize, data.data() + sizeof(MAGIC) + sizeof(FORMAT_VERSION), sizeof(uncompressedSize));
+	if (uncompressedSize == 0) return std::string();
+
+	// Don't trust the stored size with an allocation larger than the compressed data can possibly inflate to
+	if (uncompressedSize > MAX_SECTION_SIZE || uncompressedSize > (data.size() - HEADER_SIZE) * MAX_COMPRESSION_RATIO) return std::nullopt;
+
+	std::string xml(uncompressedSize, '\0');
+	int32_t err{};
+	const auto actualSize = ZCompression::Decompress(
+		reinterpret_cast<const uint8_t*>(data.data() + HEADER_SIZE), data.size() - HEADER_SIZE,
+		reinterpret_cast<uint8_t*>(xml.data()), uncompressedSize, err);
+
+	if (actualSize != static_cast<int32_t>(uncompressedSize)) return std::nullopt;
+
+	return xml;
+}
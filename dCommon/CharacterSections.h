@@ -0,0 +1,67 @@
+#ifndef __CHARACTERSECTIONS__H__
+#define __CHARACTERSECTIONS__H__
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace tinyxml2 {
+	class XMLDocument;
+};
+
+/**
+ * @brief Splits a character document into independently stored sections.
+ *
+ * Every top level element of the character document (inv, mis, flag, char, lvl, ...) becomes its own section,
+ * keyed by the element name, so a save only has to write the sections that actually changed.
+ * The section named ROOT_SECTION stores the obj root element with its attributes and an empty placeholder
+ * for every top level element, so joining the sections keeps the elements in their original order.
+ *
+ * Stored sections are wrapped in a small versioned binary header and zlib compressed, see Encode and Decode.
+ */
+namespace CharacterSections {
+	// Maps a section name to the compact xml of all top level elements with that name.
+	using SectionMap = std::map<std::string, std::string>;
+
+	constexpr std::string_view ROOT_SECTION = "obj";
+
+	constexpr uint32_t MAGIC = 0x43455343; // "CSEC"
+	constexpr uint8_t FORMAT_VERSION = 1;
+
+	// Sections claiming to decode to more than this are rejected as corrupt
+	constexpr uint32_t MAX_SECTION_SIZE = 64 * 1024 * 1024;
+
+	/**
+	 * @brief Splits a character document into its sections.
+	 *
+	 * @param doc The character document, with an obj root element
+	 * @return The sections of the document, empty if the document has no obj element
+	 */
+	SectionMap Split(const tinyxml2::XMLDocument& doc);
+
+	/**
+	 * @brief Rebuilds a character xml document from its sections.
+	 *
+	 * @param sections The sections to join
+	 * @return The compact xml of the character document
+	 */
+	std::string Join(const SectionMap& sections);
+
+	/**
+	 * @brief Encodes the xml of a section into the stored binary format.
+	 *
+	 * @return The encoded section, or std::nullopt if it could not be compressed
+	 */
+	std::optional<std::string> Encode(const std::string_view sectionXml);
+
+	/**
+	 * @brief Decodes a stored section back into its xml.
+	 *
+	 * @return The xml of the section, or std::nullopt if the data is not a valid section of a known version
+	 */
+	std::optional<std::string> Decode(const std::string_view data);
+};
+
+#endif  //!__CHARACTERSECTIONS__H__
@@ -189,6 +189,7 @@ void CatchUnhandled(int sig) {
 
 #endif // INCLUDE_BACKTRACE
 
+	if (Game::logger) Game::logger->Flush(); // Write the backtrace before exiting.
 	exit(EXIT_FAILURE);
 }
 
@@ -1,11 +1,11 @@
 #include "FdbToSqlite.h"
 
 #include <map>
-#include <fstream>
 #include <cassert>
-#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
 
-#include "BinaryIO.h"
 #include "CDClientDatabase.h"
 #include "GeneralUtils.h"
 #include "Game.h"
@@ -32,214 +32,148 @@ bool FdbToSqlite::Convert::ConvertDatabase(AssetStream& buffer) {
 	if (m_ConversionStarted) return false;
 
 	this->m_ConversionStarted = true;
+	m_Fdb = buffer.GetData();
+	const auto start = std::chrono::steady_clock::now();
 	try {
 		CDClientDatabase::Connect(m_BinaryOutPath + "/CDServer.sqlite");
 
 		CDClientDatabase::ExecuteQuery("BEGIN TRANSACTION;");
 
-		int32_t numberOfTables = ReadInt32(buffer);
-		ReadTables(numberOfTables, buffer);
+		ReadTables();
 
 		CDClientDatabase::ExecuteQuery("COMMIT;");
 	} catch (CppSQLite3Exception& e) {
 		LOG("Encountered error %s converting FDB to SQLite", e.errorMessage());
 		return false;
+	} catch (std::exception& e) {
+		LOG("Encountered error %s converting FDB to SQLite", e.what());
+		return false;
 	}
 
+	LOG("Converted FDB to SQLite in %.2f seconds", std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count());
 	return true;
 }
 
-int32_t FdbToSqlite::Convert::ReadInt32(std::istream& cdClientBuffer) {
-	int32_t nextInt{};
-	BinaryIO::BinaryRead(cdClientBuffer, nextInt);
-	return nextInt;
-}
-
-int64_t FdbToSqlite::Convert::ReadInt64(std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
+template <typename T>
+T FdbToSqlite::Convert::Read(const uint32_t offset) const {
+	if (offset > m_Fdb.size() || m_Fdb.size() - offset < sizeof(T)) throw std::out_of_range("Read past the end of the FDB file.");
 
-	int64_t value{};
-	BinaryIO::BinaryRead(cdClientBuffer, value);
-
-	cdClientBuffer.seekg(prevPosition);
+	T value;
+	std::memcpy(&value, m_Fdb.data() + offset, sizeof(T));
 	return value;
 }
 
-std::string FdbToSqlite::Convert::ReadString(std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
+std::string_view FdbToSqlite::Convert::ReadString(const uint32_t offset) const {
+	const auto position = Read<uint32_t>(offset);
+	if (position >= m_Fdb.size()) throw std::out_of_range("String past the end of the FDB file.");
 
-	auto readString = BinaryIO::ReadString(cdClientBuffer);
+	const auto end = m_Fdb.find('\0', position);
+	if (end == std::string_view::npos) throw std::out_of_range("Unterminated string in the FDB file.");
 
-	cdClientBuffer.seekg(prevPosition);
-	return readString;
+	return m_Fdb.substr(position, end - position);
 }
 
-int32_t FdbToSqlite::Convert::SeekPointer(std::istream& cdClientBuffer) {
-	int32_t position{};
-	BinaryIO::BinaryRead(cdClientBuffer, position);
-	int32_t prevPosition = cdClientBuffer.tellg();
-	cdClientBuffer.seekg(position);
-	return prevPosition;
-}
+void FdbToSqlite::Convert::ReadTables() {
+	const auto numberOfTables = Read<int32_t>(0);
+	const auto tables = Read<uint32_t>(4);
 
-std::string FdbToSqlite::Convert::ReadColumnHeader(std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
-
-	int32_t numberOfColumns = ReadInt32(cdClientBuffer);
-	std::string tableName = ReadString(cdClientBuffer);
-
-	auto columns = ReadColumns(numberOfColumns, cdClientBuffer);
-	std::string newTable = "CREATE TABLE IF NOT EXISTS '" + tableName + "' (" + columns + ");";
-	CDClientDatabase::ExecuteDML(newTable);
+	// Each table is a pointer to its column header followed by a pointer to its row header
+	for (int32_t i = 0; i < numberOfTables; i++) {
+		const uint32_t table = tables + i * 8;
 
-	cdClientBuffer.seekg(prevPosition);
+		int32_t numberOfColumns = 0;
+		const auto tableName = ReadColumnHeader(Read<uint32_t>(table), numberOfColumns);
 
-	return tableName;
-}
-
-void FdbToSqlite::Convert::ReadTables(int32_t& numberOfTables, std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
+		std::string insertQuery = "INSERT INTO '" + tableName + "' values (";
+		for (int32_t column = 0; column < numberOfColumns; column++) {
+			insertQuery += column == 0 ? "?" : ", ?";
+		}
+		insertQuery += ");";
 
-	for (int32_t i = 0; i < numberOfTables; i++) {
-		auto columnHeader = ReadColumnHeader(cdClientBuffer);
-		ReadRowHeader(columnHeader, cdClientBuffer);
+		auto insert = CDClientDatabase::CreatePreppedStmt(insertQuery);
+		ReadRows(Read<uint32_t>(table + 4), numberOfColumns, insert);
 	}
-
-	cdClientBuffer.seekg(prevPosition);
 }
 
-std::string FdbToSqlite::Convert::ReadColumns(int32_t& numberOfColumns, std::istream& cdClientBuffer) {
-	std::stringstream columnsToCreate;
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
+std::string FdbToSqlite::Convert::ReadColumnHeader(const uint32_t offset, int32_t& numberOfColumns) {
+	numberOfColumns = Read<int32_t>(offset);
+	std::string tableName(ReadString(offset + 4));
+	const auto columns = Read<uint32_t>(offset + 8);
 
-	std::string name{};
-	eSqliteDataType dataType{};
+	std::string columnsToCreate;
 	for (int32_t i = 0; i < numberOfColumns; i++) {
-		if (i != 0) columnsToCreate << ", ";
-		dataType = static_cast<eSqliteDataType>(ReadInt32(cdClientBuffer));
-		name = ReadString(cdClientBuffer);
-		columnsToCreate << "'" << name << "' " << FdbToSqlite::Convert::m_SqliteType[dataType];
+		if (i != 0) columnsToCreate += ", ";
+		const auto dataType = static_cast<eSqliteDataType>(Read<int32_t>(columns + i * 8));
+		columnsToCreate += "'";
+		columnsToCreate += ReadString(columns + i * 8 + 4);
+		columnsToCreate += "' ";
+		columnsToCreate += FdbToSqlite::Convert::m_SqliteType[dataType];
 	}
 
-	cdClientBuffer.seekg(prevPosition);
-	return columnsToCreate.str();
-}
-
-void FdbToSqlite::Convert::ReadRowHeader(std::string& tableName, std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
-
-	int32_t numberOfAllocatedRows = ReadInt32(cdClientBuffer);
-	if (numberOfAllocatedRows != 0) assert((numberOfAllocatedRows & (numberOfAllocatedRows - 1)) == 0);  // assert power of 2 allocation size
-	ReadRows(numberOfAllocatedRows, tableName, cdClientBuffer);
+	CDClientDatabase::ExecuteDML("CREATE TABLE IF NOT EXISTS '" + tableName + "' (" + columnsToCreate + ");");
 
-	cdClientBuffer.seekg(prevPosition);
+	return tableName;
 }
 
-void FdbToSqlite::Convert::ReadRows(int32_t& numberOfAllocatedRows, std::string& tableName, std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
-
-	int32_t rowid = 0;
-	for (int32_t row = 0; row < numberOfAllocatedRows; row++) {
-		int32_t rowPointer = ReadInt32(cdClientBuffer);
-		if (rowPointer == -1) rowid++;
-		else ReadRow(rowPointer, tableName, cdClientBuffer);
-	}
-
-	cdClientBuffer.seekg(prevPosition);
-}
+void FdbToSqlite::Convert::ReadRows(const uint32_t offset, const int32_t numberOfColumns, CppSQLite3Statement& insert) {
+	const auto numberOfAllocatedRows = Read<int32_t>(offset);
+	if (numberOfAllocatedRows != 0) assert((numberOfAllocatedRows & (numberOfAllocatedRows - 1)) == 0);  // assert power of 2 allocation size
+	const auto buckets = Read<uint32_t>(offset + 4);
 
-void FdbToSqlite::Convert::ReadRow(int32_t& position, std::string& tableName, std::istream& cdClientBuffer) {
-	int32_t prevPosition = cdClientBuffer.tellg();
-	cdClientBuffer.seekg(position);
+	for (int32_t bucket = 0; bucket < numberOfAllocatedRows; bucket++) {
+		auto row = Read<int32_t>(buckets + bucket * 4);
 
-	while (true) {
-		ReadRowInfo(tableName, cdClientBuffer);
-		int32_t linked = ReadInt32(cdClientBuffer);
-		if (linked == -1) break;
-		cdClientBuffer.seekg(linked);
+		// Each row in a bucket is a pointer to its row info followed by a pointer to the next row, -1 ends the bucket
+		while (row != -1) {
+			InsertRow(Read<uint32_t>(row), numberOfColumns, insert);
+			row = Read<int32_t>(row + 4);
+		}
 	}
-
-	cdClientBuffer.seekg(prevPosition);
 }
 
-void FdbToSqlite::Convert::ReadRowInfo(std::string& tableName, std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
+void FdbToSqlite::Convert::InsertRow(const uint32_t offset, const int32_t numberOfColumns, CppSQLite3Statement& insert) {
+	const auto numberOfValues = Read<int32_t>(offset);
+	if (numberOfValues != numberOfColumns) throw std::invalid_argument("Row has a different number of values than its table has columns.");
 
-	int32_t numberOfColumns = ReadInt32(cdClientBuffer);
-	ReadRowValues(numberOfColumns, tableName, cdClientBuffer);
-
-	cdClientBuffer.seekg(prevPosition);
-}
-
-void FdbToSqlite::Convert::ReadRowValues(int32_t& numberOfColumns, std::string& tableName, std::istream& cdClientBuffer) {
-	int32_t prevPosition = SeekPointer(cdClientBuffer);
-
-	int32_t emptyValue{};
-	int32_t intValue{};
-	float_t floatValue{};
-	std::string stringValue{};
-	int32_t boolValue{};
-	int64_t int64Value{};
-	bool insertedFirstEntry = false;
-	std::stringstream insertedRow;
-	insertedRow << "INSERT INTO " << tableName << " values (";
-
-	for (int32_t i = 0; i < numberOfColumns; i++) {
-		if (i != 0) insertedRow << ", "; // Only append comma and space after first entry in row.
-		switch (static_cast<eSqliteDataType>(ReadInt32(cdClientBuffer))) {
+	// Each value is its type followed by either the value or a pointer to it
+	const auto values = Read<uint32_t>(offset + 4);
+	for (int32_t i = 0; i < numberOfValues; i++) {
+		const uint32_t value = values + i * 8;
+		const int32_t parameter = i + 1;
+		switch (static_cast<eSqliteDataType>(Read<int32_t>(value))) {
 		case eSqliteDataType::NONE:
-			BinaryIO::BinaryRead(cdClientBuffer, emptyValue);
-			assert(emptyValue == 0);
-			insertedRow << "NULL";
+			assert(Read<int32_t>(value + 4) == 0);
+			insert.bindNull(parameter);
 			break;
 
 		case eSqliteDataType::INT32:
-			intValue = ReadInt32(cdClientBuffer);
-			insertedRow << intValue;
+			insert.bind(parameter, Read<int32_t>(value + 4));
 			break;
 
 		case eSqliteDataType::REAL:
-			BinaryIO::BinaryRead(cdClientBuffer, floatValue);
-			insertedRow << std::fixed << std::setprecision(34) << floatValue; // maximum precision of floating point number
+			insert.bind(parameter, static_cast<double>(Read<float>(value + 4)));
 			break;
 
 		case eSqliteDataType::TEXT_4:
 		case eSqliteDataType::TEXT_8: {
-			stringValue = ReadString(cdClientBuffer);
-			size_t position = 0;
-
-			// Need to escape quote with a double of ".
-			while (position < stringValue.size()) {
-				if (stringValue.at(position) == '\"') {
-					stringValue.insert(position, "\"");
-					position++;
-				}
-				position++;
-			}
-			insertedRow << "\"" << stringValue << "\"";
+			// Strings end at the terminator in the file, bind copies them
+			insert.bind(parameter, ReadString(value + 4).data());
 			break;
 		}
 
 		case eSqliteDataType::INT_BOOL:
-			BinaryIO::BinaryRead(cdClientBuffer, boolValue);
-			insertedRow << static_cast<bool>(boolValue);
+			insert.bind(parameter, static_cast<int32_t>(Read<int32_t>(value + 4) != 0));
 			break;
 
 		case eSqliteDataType::INT64:
-			int64Value = ReadInt64(cdClientBuffer);
-			insertedRow << std::to_string(int64Value);
+			insert.bind(parameter, static_cast<sqlite_int64>(Read<int64_t>(Read<uint32_t>(value + 4))));
 			break;
 
 		default:
 			throw std::invalid_argument("Unsupported SQLite type encountered.");
 			break;
-
 		}
 	}
 
-	insertedRow << ");";
-
-	auto copiedString = insertedRow.str();
-	CDClientDatabase::ExecuteDML(copiedString);
-	cdClientBuffer.seekg(prevPosition);
+	insert.execDML();
 }
@@ -4,12 +4,14 @@
 #pragma once
 
 #include <cstdint>
-#include <iosfwd>
 #include <map>
+#include <string>
+#include <string_view>
 
 #include "AssetManager.h"
 
 enum class eSqliteDataType : int32_t;
+class CppSQLite3Statement;
 
 namespace FdbToSqlite {
 	class Convert {
@@ -29,96 +31,57 @@ namespace FdbToSqlite {
 		 */
 		bool ConvertDatabase(AssetStream& buffer);
 
+	private:
 		/**
-		 * @brief Reads a 32 bit int from the fdb file.
-		 * 
-		 * @return The read value
-		 */
-		int32_t ReadInt32(std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Reads a 64 bit integer from the fdb file.
+		 * @brief Reads a value from the fdb file.
 		 * 
+		 * @param offset The offset of the value in the file
 		 * @return The read value
 		 */
-		int64_t ReadInt64(std::istream& cdClientBuffer);
+		template <typename T>
+		T Read(const uint32_t offset) const;
 
 		/**
-		 * @brief Reads a string from the fdb file.
+		 * @brief Reads the string a pointer in the fdb file points to.
 		 * 
-		 * @return The read string
+		 * @param offset The offset of the pointer in the file
+		 * @return The read string, viewing the file
 		 * 
 		 * TODO This needs to be translated to latin-1!
 		 */
-		std::string ReadString(std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Seeks to a pointer position.
-		 * 
-		 * @return The previous position before the seek
-		 */
-		int32_t SeekPointer(std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Reads a column header from the fdb file and creates the table in the database
-		 * 
-		 * @return The table name
-		 */
-		std::string ReadColumnHeader(std::istream& cdClientBuffer);
+		std::string_view ReadString(const uint32_t offset) const;
 
 		/**
 		 * @brief Read the tables from the fdb file.
-		 * 
-		 * @param numberOfTables The number of tables to read
 		 */
-		void ReadTables(int32_t& numberOfTables, std::istream& cdClientBuffer);
+		void ReadTables();
 
 		/**
-		 * @brief Reads the columns from the fdb file.
+		 * @brief Reads the column header of a table from the fdb file and creates the table in the database
 		 * 
-		 * @param numberOfColumns The number of columns to read
-		 * @return All columns of the table formatted for a sql query
-		 */
-		std::string ReadColumns(int32_t& numberOfColumns, std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Reads the row header from the fdb file.
-		 * 
-		 * @param tableName The tables name
-		 */
-		void ReadRowHeader(std::string& tableName, std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Read the rows from the fdb file.,
-		 * 
-		 * @param numberOfAllocatedRows The number of rows that were allocated.  Always a power of 2! 
-		 * @param tableName The tables name.
-		 */
-		void ReadRows(int32_t& numberOfAllocatedRows, std::string& tableName, std::istream& cdClientBuffer);
-
-		/**
-		 * @brief Reads a row from the fdb file.
-		 * 
-		 * @param position The position to seek in the fdb to
-		 * @param tableName The tables name
+		 * @param offset The offset of the column header
+		 * @param numberOfColumns Set to the number of columns in the table
+		 * @return The table name
 		 */
-		void ReadRow(int32_t& position, std::string& tableName, std::istream& cdClientBuffer);
+		std::string ReadColumnHeader(const uint32_t offset, int32_t& numberOfColumns);
 
 		/**
-		 * @brief Reads the row info from the fdb file.
+		 * @brief Reads the rows of a table from the fdb file and inserts them into the database.
+		 * Rows are stored in a hash table of linked lists, the number of buckets is always a power of 2.
 		 * 
-		 * @param tableName The tables name
+		 * @param offset The offset of the row header
+		 * @param insert The statement inserting a row into the table
 		 */
-		void ReadRowInfo(std::string& tableName, std::istream& cdClientBuffer);
+		void ReadRows(const uint32_t offset, const int32_t numberOfColumns, CppSQLite3Statement& insert);
 
 		/**
-		 * @brief Reads each row and its values from the fdb file and inserts them into the database
+		 * @brief Binds the values of a row to the insert statement and runs it
 		 * 
-		 * @param numberOfColumns The number of columns to read in
-		 * @param tableName The tables name
+		 * @param offset The offset of the row info
+		 * @param numberOfColumns The number of columns of the table
+		 * @param insert The statement inserting a row into the table
 		 */
-		void ReadRowValues(int32_t& numberOfColumns, std::string& tableName, std::istream& cdClientBuffer);
-	private:
+		void InsertRow(const uint32_t offset, const int32_t numberOfColumns, CppSQLite3Statement& insert);
 
 		/**
 		 * Maps each sqlite data type to its string equivalent.
@@ -139,6 +102,11 @@ namespace FdbToSqlite {
 		 * The path where the CDServer will be stored
 		 */
 		std::string m_BinaryOutPath{};
+
+		/**
+		 * The fdb file being converted
+		 */
+		std::string_view m_Fdb{};
 	}; //! class FdbToSqlite
 }; //! namespace FdbToSqlite
 
@@ -1,9 +1,196 @@
 #include "Logger.h"
 
 #include <algorithm>
-#include <ctime>
+#include <chrono>
 #include <filesystem>
-#include <stdarg.h>
+
+namespace {
+	// The messages a thread can have waiting to be written before new ones are dropped
+	constexpr uint32_t ringCapacity = 256 * 1024;
+
+	// How long the logging thread sleeps between writing batches of messages
+	constexpr auto writeInterval = std::chrono::milliseconds(5);
+
+	// The longest Flush waits for a batch that is being written
+	constexpr auto flushTimeout = std::chrono::seconds(1);
+
+	std::atomic<uint64_t> nextLoggerId = 1;
+
+	struct RecordHeader {
+		// The size of the record including the header, 0 marks that the rest of the ring is unused
+		uint32_t size;
+		uint32_t argumentsSize;
+		time_t time;
+		const char* filenameAndLine;
+		const char* format;
+	};
+
+	constexpr uint32_t AlignRecord(const uint32_t size) {
+		return (size + alignof(RecordHeader) - 1) & ~static_cast<uint32_t>(alignof(RecordHeader) - 1);
+	}
+
+	class ArgumentReader {
+	public:
+		ArgumentReader(const char* data, const uint32_t size) : m_Data{ data }, m_Size{ size } {};
+
+		bool Next(LogArguments::Type& type, uint64_t& value, const char*& string) {
+			if (m_Position >= m_Size) return false;
+
+			type = static_cast<LogArguments::Type>(m_Data[m_Position++]);
+			if (type == LogArguments::Type::STRING) {
+				uint32_t length;
+				std::memcpy(&length, m_Data + m_Position, sizeof(length));
+				string = m_Data + m_Position + sizeof(length);
+				m_Position += sizeof(length) + length + 1;
+			} else {
+				std::memcpy(&value, m_Data + m_Position, sizeof(value));
+				m_Position += sizeof(value);
+			}
+			return true;
+		}
+
+	private:
+		const char* m_Data;
+		uint32_t m_Size;
+		uint32_t m_Position = 0;
+	};
+
+	template<typename T>
+	void AppendFormatted(std::string& out, const char* spec, const T value) {
+		char buffer[256];
+		const int length = snprintf(buffer, sizeof(buffer), spec, value);
+		if (length < 0) return;
+
+		if (static_cast<size_t>(length) < sizeof(buffer)) {
+			out.append(buffer, length);
+			return;
+		}
+
+		const auto offset = out.size();
+		out.resize(offset + length + 1);
+		snprintf(out.data() + offset, length + 1, spec, value);
+		out.resize(offset + length);
+	}
+
+	int64_t ToSigned(const LogArguments::Type type, const uint64_t value) {
+		if (type != LogArguments::Type::DOUBLE) return static_cast<int64_t>(value);
+
+		double floating;
+		std::memcpy(&floating, &value, sizeof(floating));
+		return static_cast<int64_t>(floating);
+	}
+
+	double ToDouble(const LogArguments::Type type, const uint64_t value) {
+		if (type == LogArguments::Type::INT) return static_cast<double>(static_cast<int64_t>(value));
+		if (type != LogArguments::Type::DOUBLE) return static_cast<double>(value);
+
+		double floating;
+		std::memcpy(&floating, &value, sizeof(floating));
+		return floating;
+	}
+};
+
+/**
+ * A ring buffer with a single producer, the thread that logs, and a single consumer, the logging thread.
+ */
+class Logger::Ring {
+public:
+	Ring() : m_Buffer(std::make_unique<char[]>(ringCapacity)) {};
+
+	// Marks that the thread will not log to this ring again, called after its last Push
+	void Abandon() { m_Abandoned.store(true, std::memory_order_release); }
+	bool IsAbandoned() const { return m_Abandoned.load(std::memory_order_acquire); }
+
+	bool Push(const char* filenameAndLine, const char* format, const LogArguments& arguments) {
+		const uint32_t size = AlignRecord(sizeof(RecordHeader) + arguments.GetSize());
+		const uint64_t head = m_Head.load(std::memory_order_relaxed);
+		const uint64_t tail = m_Tail.load(std::memory_order_acquire);
+
+		// A record is never split, the space left at the end of the ring is skipped if it does not fit
+		const uint32_t offset = head % ringCapacity;
+		const uint32_t skipped = ringCapacity - offset < size ? ringCapacity - offset : 0;
+		if (ringCapacity - (head - tail) < skipped + size) return false;
+
+		if (skipped != 0) {
+			const uint32_t marker = 0;
+			std::memcpy(m_Buffer.get() + offset, &marker, sizeof(marker));
+		}
+
+		RecordHeader header{ size, arguments.GetSize(), time(NULL), filenameAndLine, format };
+		char* record = m_Buffer.get() + (head + skipped) % ringCapacity;
+		std::memcpy(record, &header, sizeof(header));
+		std::memcpy(record + sizeof(header), arguments.GetData(), arguments.GetSize());
+
+		m_Head.store(head + skipped + size, std::memory_order_release);
+		return true;
+	}
+
+	template<typename Consumer>
+	void Consume(Consumer&& consumer) {
+		uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+		const uint64_t head = m_Head.load(std::memory_order_acquire);
+
+		while (tail != head) {
+			const uint32_t offset = tail % ringCapacity;
+			RecordHeader header;
+			std::memcpy(&header.size, m_Buffer.get() + offset, sizeof(header.size));
+			if (header.size == 0) {
+				tail += ringCapacity - offset;
+				continue;
+			}
+
+			std::memcpy(&header, m_Buffer.get() + offset, sizeof(header));
+			consumer(header, m_Buffer.get() + offset + sizeof(header));
+			tail += header.size;
+		}
+
+		m_Tail.store(tail, std::memory_order_release);
+	}
+
+private:
+	std::unique_ptr<char[]> m_Buffer;
+	std::atomic<bool> m_Abandoned = false;
+	alignas(64) std::atomic<uint64_t> m_Head = 0;
+	alignas(64) std::atomic<uint64_t> m_Tail = 0;
+};
+
+struct Logger::ThreadRing {
+	uint64_t loggerId = 0;
+	// Shared with the logger, so whichever of the two goes first does not leave the other with a dangling ring
+	std::shared_ptr<Ring> ring;
+
+	~ThreadRing() { Release(); }
+
+	void Release() {
+		if (ring) ring->Abandon();
+		ring.reset();
+		loggerId = 0;
+	}
+};
+
+thread_local Logger::ThreadRing Logger::s_ThreadRing;
+
+void LogArguments::AddValue(const Type type, const uint64_t value) {
+	if (m_Size + 1 + sizeof(value) > m_Data.size()) return;
+
+	m_Data[m_Size++] = static_cast<char>(type);
+	std::memcpy(m_Data.data() + m_Size, &value, sizeof(value));
+	m_Size += sizeof(value);
+}
+
+void LogArguments::AddString(std::string_view value) {
+	constexpr uint32_t overhead = 1 + sizeof(uint32_t) + 1;
+	if (m_Size + overhead > m_Data.size()) return;
+
+	// Strings that do not fit are cut off
+	const uint32_t length = std::min<size_t>(value.size(), m_Data.size() - m_Size - overhead);
+	m_Data[m_Size++] = static_cast<char>(Type::STRING);
+	std::memcpy(m_Data.data() + m_Size, &length, sizeof(length));
+	m_Size += sizeof(length);
+	std::memcpy(m_Data.data() + m_Size, value.data(), length);
+	m_Size += length;
+	m_Data[m_Size++] = '\0';
+}
 
 Writer::~Writer() {
 	// Flush before we close
@@ -40,56 +227,276 @@ ConsoleWriter::ConsoleWriter(bool enabled) {
 	m_IsConsoleWriter = true;
 }
 
-Logger::Logger(const std::string& outpath, bool logToConsole, bool logDebugStatements) {
+Logger::Logger(const std::string& outpath, bool logToConsole, bool logDebugStatements) : m_Id{ nextLoggerId++ } {
 	m_logDebugStatements = logDebugStatements;
 	std::filesystem::path outpathPath(outpath);
 	if (!std::filesystem::exists(outpathPath.parent_path())) std::filesystem::create_directories(outpathPath.parent_path());
 	m_Writers.push_back(std::make_unique<FileWriter>(outpath));
 	m_Writers.push_back(std::make_unique<ConsoleWriter>(logToConsole));
+
+	m_Thread = std::thread(&Logger::WriteLoop, this);
 }
 
-void Logger::vLog(const char* format, va_list args) {
-	time_t t = time(NULL);
-	struct tm* time = localtime(&t);
-	char timeStr[70];
-	strftime(timeStr, sizeof(timeStr), "[%d-%m-%y %H:%M:%S ", time);
-	char message[2048];
-	vsnprintf(message, 2048, format, args);
-	for (const auto& writer : m_Writers) {
-		writer->Log(timeStr, message);
+Logger::~Logger() {
+	{
+		std::lock_guard lock(m_StopMutex);
+		m_Stopping = true;
+	}
+	m_StopCondition.notify_all();
+	if (m_Thread.joinable()) m_Thread.join();
+
+	// Write whatever was logged while the thread stopped
+	std::lock_guard lock(m_WriteMutex);
+	Drain();
+}
+
+void Logger::Push(const char* filenameAndLine, const char* format, const LogArguments& arguments) {
+	auto* ring = GetThreadRing();
+	if (!ring->Push(filenameAndLine, format, arguments)) m_Dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t Logger::GetThreadRings() const {
+	std::lock_guard lock(m_RingsMutex);
+	return m_Rings.size();
+}
+
+Logger::Ring* Logger::GetThreadRing() {
+	if (s_ThreadRing.loggerId == m_Id) return s_ThreadRing.ring.get();
+
+	// The thread logged to another logger before, that one can free the ring once it wrote what is left in it
+	s_ThreadRing.Release();
+
+	auto ring = std::make_shared<Ring>();
+	{
+		std::lock_guard lock(m_RingsMutex);
+		m_Rings.push_back(ring);
+	}
+
+	s_ThreadRing.loggerId = m_Id;
+	s_ThreadRing.ring = std::move(ring);
+	return s_ThreadRing.ring.get();
+}
+
+void Logger::WriteLoop() {
+	while (true) {
+		{
+			std::unique_lock lock(m_StopMutex);
+			m_StopCondition.wait_for(lock, writeInterval, [this]() { return m_Stopping; });
+			if (m_Stopping) return;
+		}
+
+		std::lock_guard lock(m_WriteMutex);
+		Drain();
+	}
+}
+
+void Logger::Drain() {
+	std::vector<Ring*> rings;
+	{
+		std::lock_guard lock(m_RingsMutex);
+		rings.reserve(m_Rings.size());
+		for (const auto& ring : m_Rings) rings.push_back(ring.get());
+	}
+
+	std::vector<Ring*> abandoned;
+	for (auto* ring : rings) {
+		// Checked before consuming, so nothing can be pushed to an abandoned ring after it was emptied
+		if (ring->IsAbandoned()) abandoned.push_back(ring);
+
+		ring->Consume([this](const RecordHeader& header, const char* arguments) {
+			m_Line = header.filenameAndLine;
+			m_Line += "] ";
+			FormatMessage(header.format, arguments, header.argumentsSize, m_Line);
+			m_Line += '\n';
+
+			const char* timeString = GetTimeString(header.time);
+			for (const auto& writer : m_Writers) {
+				writer->Log(timeString, m_Line.c_str());
+			}
+		});
+	}
+
+	if (!abandoned.empty()) {
+		std::lock_guard lock(m_RingsMutex);
+		std::erase_if(m_Rings, [&abandoned](const auto& ring) { return std::ranges::find(abandoned, ring.get()) != abandoned.end(); });
+	}
+
+	const auto dropped = m_Dropped.load(std::memory_order_relaxed);
+	if (dropped != m_ReportedDropped) {
+		m_Line = "Logger] Dropped " + std::to_string(dropped - m_ReportedDropped) + " log messages\n";
+		m_ReportedDropped = dropped;
+
+		const char* timeString = GetTimeString(time(NULL));
+		for (const auto& writer : m_Writers) {
+			writer->Log(timeString, m_Line.c_str());
+		}
 	}
 }
 
-void Logger::Log(const char* className, const char* format, ...) {
-	va_list args;
-	std::string log = std::string(className) + "] " + std::string(format) + "\n";
-	va_start(args, format);
-	vLog(log.c_str(), args);
-	va_end(args);
+const char* Logger::GetTimeString(const time_t time) {
+	if (time == m_CachedTime) return m_CachedTimeString;
+
+	m_CachedTime = time;
+	struct tm* localTime = localtime(&time);
+	strftime(m_CachedTimeString, sizeof(m_CachedTimeString), "[%d-%m-%y %H:%M:%S ", localTime);
+	return m_CachedTimeString;
 }
 
-void Logger::LogDebug(const char* className, const char* format, ...) {
-	if (!m_logDebugStatements) return;
-	va_list args;
-	std::string log = std::string(className) + "] " + std::string(format) + "\n";
-	va_start(args, format);
-	vLog(log.c_str(), args);
-	va_end(args);
+void Logger::FormatMessage(const char* format, const char* arguments, const uint32_t argumentsSize, std::string& out) {
+	ArgumentReader reader(arguments, argumentsSize);
+	LogArguments::Type type;
+	uint64_t value = 0;
+	const char* string = nullptr;
+
+	while (*format) {
+		const char* percent = std::strchr(format, '%');
+		if (!percent) {
+			out += format;
+			return;
+		}
+
+		out.append(format, percent - format);
+		format = percent + 1;
+		if (*format == '%') {
+			out += '%';
+			format++;
+			continue;
+		}
+
+		// Rebuild the conversion with the length modifier snprintf needs for the captured argument
+		char spec[32] = "%";
+		size_t specLength = 1;
+		const auto appendSpec = [&spec, &specLength](const char* text, const size_t length) {
+			const auto copied = std::min(length, sizeof(spec) - 4 - specLength);
+			std::memcpy(spec + specLength, text, copied);
+			specLength += copied;
+			spec[specLength] = '\0';
+		};
+
+		const char* flags = format;
+		while (*format && std::strchr("-+ #0'", *format)) format++;
+		appendSpec(flags, format - flags);
+
+		// Width and precision given as * are arguments of their own
+		for (const bool precision : { false, true }) {
+			if (precision) {
+				if (*format != '.') break;
+				appendSpec(format++, 1);
+			}
+
+			if (*format == '*') {
+				format++;
+				const auto fromArgument = reader.Next(type, value, string) ? std::to_string(ToSigned(type, value)) : "0";
+				appendSpec(fromArgument.c_str(), fromArgument.size());
+			} else {
+				const char* digits = format;
+				while (*format >= '0' && *format <= '9') format++;
+				appendSpec(digits, format - digits);
+			}
+		}
+
+		char length[3]{};
+		for (size_t i = 0; i < 2 && *format && std::strchr("hljztLqI", *format); i++) length[i] = *format++;
+
+		const char conversion = *format;
+		if (conversion == '\0') return;
+		format++;
+
+		if (!reader.Next(type, value, string)) {
+			out += "(missing)";
+			continue;
+		}
+
+		switch (conversion) {
+		case 'd':
+		case 'i': {
+			auto signedValue = ToSigned(type, value);
+			if (std::strcmp(length, "hh") == 0) signedValue = static_cast<signed char>(signedValue);
+			else if (length[0] == 'h') signedValue = static_cast<short>(signedValue);
+			else if (length[0] == '\0') signedValue = static_cast<int>(signedValue);
+			else if (length[0] == 'l' && length[1] == '\0') signedValue = static_cast<long>(signedValue);
+
+			const char modified[] = { 'l', 'l', conversion };
+			appendSpec(modified, sizeof(modified));
+			AppendFormatted(out, spec, static_cast<long long>(signedValue));
+			break;
+		}
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+		case 'c': {
+			auto unsignedValue = static_cast<uint64_t>(ToSigned(type, value));
+			if (conversion == 'c') {
+				appendSpec("c", 1);
+				AppendFormatted(out, spec, static_cast<int>(unsignedValue));
+				break;
+			}
+
+			if (std::strcmp(length, "hh") == 0) unsignedValue = static_cast<unsigned char>(unsignedValue);
+			else if (length[0] == 'h') unsignedValue = static_cast<unsigned short>(unsignedValue);
+			else if (length[0] == '\0') unsignedValue = static_cast<unsigned int>(unsignedValue);
+			else if (length[0] == 'l' && length[1] == '\0') unsignedValue = static_cast<unsigned long>(unsignedValue);
+
+			const char modified[] = { 'l', 'l', conversion };
+			appendSpec(modified, sizeof(modified));
+			AppendFormatted(out, spec, static_cast<unsigned long long>(unsignedValue));
+			break;
+		}
+		case 'f':
+		case 'F':
+		case 'e':
+		case 'E':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A':
+			appendSpec(&conversion, 1);
+			AppendFormatted(out, spec, ToDouble(type, value));
+			break;
+		case 's':
+			appendSpec("s", 1);
+			AppendFormatted(out, spec, type == LogArguments::Type::STRING ? string : "(?)");
+			break;
+		case 'p':
+			appendSpec("p", 1);
+			AppendFormatted(out, spec, reinterpret_cast<void*>(static_cast<uintptr_t>(value)));
+			break;
+		case 'n':
+			// Nothing to write back to
+			break;
+		default:
+			out += '%';
+			out += conversion;
+			break;
+		}
+	}
 }
 
-void Logger::Flush() {
+bool Logger::Flush() {
+	std::unique_lock lock(m_WriteMutex, std::defer_lock);
+	if (!lock.try_lock_for(flushTimeout)) {
+		// The writers are busy, so this can't go through them
+		fprintf(stderr, "Logger] Flush timed out, messages are written once the logging thread catches up\n");
+		return false;
+	}
+
+	Drain();
 	for (const auto& writer : m_Writers) {
 		writer->Flush();
 	}
+	return true;
 }
 
 void Logger::SetLogToConsole(bool logToConsole) {
+	std::lock_guard lock(m_WriteMutex);
 	for (const auto& writer : m_Writers) {
 		if (writer->IsConsoleWriter()) writer->SetEnabled(logToConsole);
 	}
 }
 
 bool Logger::GetLogToConsole() const {
+	std::lock_guard lock(m_WriteMutex);
 	bool toReturn = false;
 	for (const auto& writer : m_Writers) {
 		if (writer->IsConsoleWriter()) toReturn |= writer->GetEnabled();
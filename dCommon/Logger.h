@@ -1,7 +1,18 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #define STRINGIFY_IMPL(x) #x
@@ -66,24 +77,213 @@ public:
 	ConsoleWriter(bool enabled);
 };
 
+/**
+ * The arguments of a log message, copied so they can be formatted on the logging thread.
+ * Strings are copied by value, every other argument is widened to 64 bits.
+ */
+class LogArguments {
+public:
+	enum class Type : uint8_t {
+		INT,
+		UNSIGNED_INT,
+		DOUBLE,
+		POINTER,
+		STRING
+	};
+
+	template<typename T>
+	void Add(const T& value);
+
+	const char* GetData() const { return m_Data.data(); }
+	uint32_t GetSize() const { return m_Size; }
+
+private:
+	void AddValue(const Type type, const uint64_t value);
+	void AddString(std::string_view value);
+
+	std::array<char, 1024> m_Data;
+	uint32_t m_Size = 0;
+};
+
+template<typename T>
+void LogArguments::Add(const T& value) {
+	using Value = std::decay_t<T>;
+	if constexpr (std::is_same_v<Value, char*> || std::is_same_v<Value, const char*>) {
+		AddString(value ? std::string_view(value) : std::string_view("(null)"));
+	} else if constexpr (std::is_convertible_v<const Value&, std::string_view>) {
+		AddString(std::string_view(value));
+	} else if constexpr (std::is_floating_point_v<Value>) {
+		const double widened = value;
+		uint64_t bits;
+		std::memcpy(&bits, &widened, sizeof(bits));
+		AddValue(Type::DOUBLE, bits);
+	} else if constexpr (std::is_enum_v<Value>) {
+		Add(static_cast<std::underlying_type_t<Value>>(value));
+	} else if constexpr (std::is_integral_v<Value> && std::is_signed_v<Value>) {
+		AddValue(Type::INT, static_cast<uint64_t>(static_cast<int64_t>(value)));
+	} else if constexpr (std::is_integral_v<Value>) {
+		AddValue(Type::UNSIGNED_INT, static_cast<uint64_t>(value));
+	} else if constexpr (std::is_pointer_v<Value> || std::is_null_pointer_v<Value>) {
+		AddValue(Type::POINTER, reinterpret_cast<uintptr_t>(value));
+	} else {
+		// Could never be printed through printf style formatting either
+		AddString("(?)");
+	}
+}
+
+// Called when a log format does not match its arguments, which fails the compilation since it is not constexpr
+void LogFormatDoesNotMatchArguments();
+
+/**
+ * A log format that is checked against its arguments at compile time, like the compiler checks printf formats.
+ * Conversions have to match the kind of their argument and the number of arguments has to match. Length modifiers
+ * are not checked, every argument is captured at its full width and formatted with the width it was captured with.
+ */
+template<typename... Args>
+class LogFormat {
+public:
+	template<typename T> requires std::is_convertible_v<const T&, const char*>
+	consteval LogFormat(const T& format) : m_Format{ format } {
+		constexpr std::array<std::optional<LogArguments::Type>, sizeof...(Args)> types = { GetType<std::decay_t<Args>>()... };
+		size_t next = 0;
+		const auto expect = [&types, &next](const LogArguments::Type type) {
+			if (next >= types.size() || types[next++] != type) LogFormatDoesNotMatchArguments();
+		};
+
+		for (const char* c = m_Format; *c; c++) {
+			if (*c != '%') continue;
+			if (*++c == '%') continue;
+
+			while (*c && IsAnyOf(*c, "-+ #0'")) c++;
+			for (const bool precision : { false, true }) {
+				if (precision) {
+					if (*c != '.') break;
+					c++;
+				}
+				if (*c == '*') {
+					expect(LogArguments::Type::INT);
+					c++;
+				}
+				while (*c >= '0' && *c <= '9') c++;
+			}
+			while (*c && IsAnyOf(*c, "hljztLqI")) c++;
+
+			if (IsAnyOf(*c, "diuoxXc")) expect(LogArguments::Type::INT);
+			else if (IsAnyOf(*c, "fFeEgGaA")) expect(LogArguments::Type::DOUBLE);
+			else if (*c == 's') expect(LogArguments::Type::STRING);
+			else if (*c == 'p') expect(LogArguments::Type::POINTER);
+			else LogFormatDoesNotMatchArguments();
+		}
+
+		if (next != types.size()) LogFormatDoesNotMatchArguments();
+	}
+
+	const char* Get() const { return m_Format; }
+
+private:
+	// The type LogArguments captures a value as, or no type for values it can't capture
+	template<typename Value>
+	static consteval std::optional<LogArguments::Type> GetType() {
+		if constexpr (std::is_same_v<Value, char*> || std::is_same_v<Value, const char*> || std::is_convertible_v<const Value&, std::string_view>) {
+			return LogArguments::Type::STRING;
+		} else if constexpr (std::is_floating_point_v<Value>) {
+			return LogArguments::Type::DOUBLE;
+		} else if constexpr (std::is_enum_v<Value> || std::is_integral_v<Value>) {
+			return LogArguments::Type::INT;
+		} else if constexpr (std::is_pointer_v<Value> || std::is_null_pointer_v<Value>) {
+			return LogArguments::Type::POINTER;
+		} else {
+			return std::nullopt;
+		}
+	}
+
+	static consteval bool IsAnyOf(const char c, const char* characters) {
+		for (; *characters; characters++) if (c == *characters) return true;
+		return false;
+	}
+
+	const char* m_Format;
+};
+
+/**
+ * Logs to a file and the console without blocking the thread that logs.
+ * A message only copies its arguments into a ring of the logging thread, a background thread
+ * formats and writes them in batches. Messages that do not fit in a full ring are counted and dropped.
+ */
 class Logger {
 public:
 	Logger() = delete;
 	Logger(const std::string& outpath, bool logToConsole, bool logDebugStatements);
+	~Logger();
 
-	void Log(const char* filenameAndLine, const char* format, ...);
-	void LogDebug(const char* filenameAndLine, const char* format, ...);
+	Logger(const Logger&) = delete;
+	Logger& operator=(const Logger&) = delete;
 
-	void Flush();
+	template<typename... Args>
+	void Log(const char* filenameAndLine, const LogFormat<std::type_identity_t<Args>...> format, const Args&... args) {
+		LogArguments arguments;
+		(arguments.Add(args), ...);
+		Push(filenameAndLine, format.Get(), arguments);
+	}
+
+	template<typename... Args>
+	void LogDebug(const char* filenameAndLine, const LogFormat<std::type_identity_t<Args>...> format, const Args&... args) {
+		if (!m_logDebugStatements) return;
+		Log(filenameAndLine, format, args...);
+	}
+
+	// Writes every message logged so far and flushes the writers.
+	// Returns false if the logging thread held the writers for too long, nothing is written then.
+	bool Flush();
 
 	bool GetLogToConsole() const;
 	void SetLogToConsole(bool logToConsole);
 
 	void SetLogDebugStatements(bool logDebugStatements) { m_logDebugStatements = logDebugStatements; }
 
+	// The number of messages dropped because the ring of their thread was full
+	uint64_t GetDroppedMessages() const { return m_Dropped; }
+
+	// The number of threads with a ring, the ring of a thread that exited is freed once its messages are written
+	uint32_t GetThreadRings() const;
+
+	/**
+	 * Formats a message like printf would, from arguments captured by LogArguments.
+	 */
+	static void FormatMessage(const char* format, const char* arguments, const uint32_t argumentsSize, std::string& out);
+
 private:
-	void vLog(const char* format, va_list args);
+	class Ring;
+
+	// The ring the calling thread logs to, handed back to the logger to free once the thread exits
+	struct ThreadRing;
+	static thread_local ThreadRing s_ThreadRing;
+
+	void Push(const char* filenameAndLine, const char* format, const LogArguments& arguments);
+	Ring* GetThreadRing();
+	void WriteLoop();
+
+	// Formats and writes the messages in every ring and frees the rings of threads that exited, m_WriteMutex has to be locked
+	void Drain();
+	const char* GetTimeString(const time_t time);
 
-	bool m_logDebugStatements;
+	std::atomic<bool> m_logDebugStatements;
 	std::vector<std::unique_ptr<Writer>> m_Writers;
+
+	const uint64_t m_Id;
+	mutable std::mutex m_RingsMutex;
+	std::vector<std::shared_ptr<Ring>> m_Rings;
+
+	mutable std::timed_mutex m_WriteMutex;
+	std::string m_Line;
+	time_t m_CachedTime = 0;
+	char m_CachedTimeString[70]{};
+
+	std::atomic<uint64_t> m_Dropped = 0;
+	uint64_t m_ReportedDropped = 0;
+
+	std::mutex m_StopMutex;
+	std::condition_variable m_StopCondition;
+	bool m_Stopping = false;
+	std::thread m_Thread;
 };
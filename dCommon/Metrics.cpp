@@ -1,5 +1,6 @@
 #include "Metrics.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 std::unordered_map<MetricVariable, Metric*> Metrics::m_Metrics = {};
@@ -11,6 +12,7 @@ std::vector<MetricVariable> Metrics::m_Variables = {
 	MetricVariable::Physics,
 	MetricVariable::UpdateReplica,
 	MetricVariable::Ghosting,
+	MetricVariable::EntityConstruction,
 	MetricVariable::CPUTime,
 	MetricVariable::Sleep,
 	MetricVariable::Frame,
@@ -72,6 +74,25 @@ const Metric* Metrics::GetMetric(MetricVariable variable) {
 	return metric;
 }
 
+int64_t Metrics::GetPercentile(MetricVariable variable, float percentile) {
+	const auto& iter = m_Metrics.find(variable);
+
+	if (iter == m_Metrics.end() || iter->second->measurementSize == 0) {
+		return -1;
+	}
+
+	const Metric* metric = iter->second;
+
+	std::vector<int64_t> sorted(metric->measurements, metric->measurements + metric->measurementSize);
+
+	percentile = std::clamp(percentile, 0.0f, 1.0f);
+	const auto index = std::min<size_t>(static_cast<size_t>(percentile * sorted.size()), sorted.size() - 1);
+
+	std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+
+	return sorted[index];
+}
+
 void Metrics::StartMeasurement(MetricVariable variable) {
 	const auto& iter = m_Metrics.find(variable);
 
@@ -132,6 +153,8 @@ std::string Metrics::MetricVariableToString(MetricVariable variable) {
 		return "Frame";
 	case MetricVariable::Ghosting:
 		return "Ghosting";
+	case MetricVariable::EntityConstruction:
+		return "EntityConstruction";
 
 	default:
 		return "Invalid";
@@ -17,6 +17,7 @@ enum class MetricVariable : int32_t
 	Physics,
 	UpdateReplica,
 	Ghosting,
+	EntityConstruction,
 	CPUTime,
 	Sleep,
 	Frame,
@@ -41,6 +42,8 @@ public:
 	static void AddMeasurement(MetricVariable variable, int64_t value);
 	static void AddMeasurement(Metric* metric, int64_t value);
 	static const Metric* GetMetric(MetricVariable variable);
+	// Returns the measurement below which the given share (0 to 1) of the stored measurements fall, -1 if there are none
+	static int64_t GetPercentile(MetricVariable variable, float percentile);
 	static void StartMeasurement(MetricVariable variable);
 	static void EndMeasurement(MetricVariable variable);
 	static float ToMiliseconds(int64_t nanoseconds);
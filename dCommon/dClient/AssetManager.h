@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <filesystem>
@@ -29,6 +30,12 @@ struct AssetMemoryBuffer : std::streambuf {
 		if (m_Success) free(m_Base);
 	}
 
+	// The whole file, independent of the read position
+	std::string_view GetData() const {
+		if (!m_Success) return {};
+		return std::string_view(eback(), egptr() - eback());
+	}
+
 	pos_type seekpos(pos_type sp, std::ios_base::openmode which) override {
 		return seekoff(sp - pos_type(off_type(0)), std::ios_base::beg, which);
 	}
@@ -56,6 +63,10 @@ struct AssetStream : std::istream {
 	operator bool() {
 		return reinterpret_cast<AssetMemoryBuffer*>(rdbuf())->m_Success;
 	}
+
+	std::string_view GetData() const {
+		return reinterpret_cast<const AssetMemoryBuffer*>(rdbuf())->GetData();
+	}
 };
 
 class AssetManager {
@@ -4,8 +4,8 @@
 #include <cstdint>
 
 enum class eMasterMessageType : uint32_t {
-	REQUEST_PERSISTENT_ID = 1,
-	REQUEST_PERSISTENT_ID_RESPONSE,
+	REQUEST_PERSISTENT_ID_BLOCK = 1,
+	REQUEST_PERSISTENT_ID_BLOCK_RESPONSE,
 	REQUEST_ZONE_TRANSFER,
 	REQUEST_ZONE_TRANSFER_RESPONSE,
 	SERVER_INFO,
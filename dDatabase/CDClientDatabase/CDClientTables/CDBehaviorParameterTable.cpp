@@ -3,6 +3,14 @@
 
 namespace {
 	std::unordered_map<std::string, uint32_t> m_ParametersList;
+
+	// Behaviors whose parameters were loaded by LoadBehavior
+	std::unordered_set<uint32_t> m_LoadedBehaviors;
+	bool m_IsFullyLoaded = false;
+
+	uint32_t GetParameterId(const std::string& name) {
+		return m_ParametersList.try_emplace(name, m_ParametersList.size()).first->second;
+	}
 };
 
 uint64_t GetKey(const uint32_t behaviorID, const uint32_t parameterID) {
@@ -18,14 +26,7 @@ void CDBehaviorParameterTable::LoadValuesFromDatabase() {
 	auto& entries = GetEntriesMutable();
 	while (!tableData.eof()) {
 		uint32_t behaviorID = tableData.getIntField("behaviorID", -1);
-		auto candidateStringToAdd = std::string(tableData.getStringField("parameterID", ""));
-		auto parameter = m_ParametersList.find(candidateStringToAdd);
-		uint32_t parameterId;
-		if (parameter != m_ParametersList.end()) {
-			parameterId = parameter->second;
-		} else {
-			parameterId = m_ParametersList.insert(std::make_pair(candidateStringToAdd, m_ParametersList.size())).first->second;
-		}
+		uint32_t parameterId = GetParameterId(tableData.getStringField("parameterID", ""));
 		uint64_t hash = GetKey(behaviorID, parameterId);
 		float value = tableData.getFloatField("value", -1.0f);
 
@@ -34,9 +35,31 @@ void CDBehaviorParameterTable::LoadValuesFromDatabase() {
 		tableData.nextRow();
 	}
 	tableData.finalize();
+	m_IsFullyLoaded = true;
+}
+
+void CDBehaviorParameterTable::LoadBehavior(const uint32_t behaviorID) {
+	if (m_IsFullyLoaded || !m_LoadedBehaviors.insert(behaviorID).second) return;
+
+	auto query = CDClientDatabase::CreatePreppedStmt("SELECT parameterID, value FROM BehaviorParameter WHERE behaviorID = ?;");
+	query.bind(1, static_cast<int32_t>(behaviorID));
+
+	auto tableData = query.execQuery();
+	auto& entries = GetEntriesMutable();
+	while (!tableData.eof()) {
+		uint32_t parameterId = GetParameterId(tableData.getStringField("parameterID", ""));
+		float value = tableData.getFloatField("value", -1.0f);
+
+		entries.insert(std::make_pair(GetKey(behaviorID, parameterId), value));
+
+		tableData.nextRow();
+	}
+	tableData.finalize();
 }
 
 float CDBehaviorParameterTable::GetValue(const uint32_t behaviorID, const std::string& name, const float defaultValue) {
+	LoadBehavior(behaviorID);
+
 	auto parameterID = m_ParametersList.find(name);
 	if (parameterID == m_ParametersList.end()) return defaultValue;
 	auto hash = GetKey(behaviorID, parameterID->second);
@@ -48,6 +71,8 @@ float CDBehaviorParameterTable::GetValue(const uint32_t behaviorID, const std::s
 }
 
 std::map<std::string, float> CDBehaviorParameterTable::GetParametersByBehaviorID(uint32_t behaviorID) {
+	LoadBehavior(behaviorID);
+
 	auto& entries = GetEntriesMutable();
 	uint64_t hashBase = behaviorID;
 	std::map<std::string, float> returnInfo;
@@ -12,6 +12,9 @@ class CDBehaviorParameterTable : public CDTable<CDBehaviorParameterTable, std::u
 public:
 	void LoadValuesFromDatabase();
 
+	// Loads the parameters of a single behavior, unless the whole table is already loaded.
+	void LoadBehavior(const uint32_t behaviorID);
+
 	float GetValue(const uint32_t behaviorID, const std::string& name, const float defaultValue = 0);
 
 	std::map<std::string, float> GetParametersByBehaviorID(uint32_t behaviorID);
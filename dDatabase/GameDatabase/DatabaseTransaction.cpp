@@ -0,0 +1,31 @@
+#include "DatabaseTransaction.h"
+
+#include <exception>
+#include <string>
+
+#include "GameDatabase.h"
+#include "Logger.h"
+
+DatabaseTransaction::DatabaseTransaction(GameDatabase& database) : m_Database{ database } {
+	m_Owner = m_Database.GetAutoCommit();
+	if (m_Owner) m_Database.SetAutoCommit(false);
+}
+
+DatabaseTransaction::~DatabaseTransaction() {
+	if (!m_Owner || m_Finished) return;
+
+	try {
+		m_Database.Rollback();
+		m_Database.SetAutoCommit(true);
+	} catch (const std::exception& ex) {
+		LOG("Failed to roll back a transaction: %s", ex.what());
+	}
+}
+
+void DatabaseTransaction::Commit() {
+	if (!m_Owner || m_Finished) return;
+
+	m_Database.Commit();
+	m_Finished = true;
+	m_Database.SetAutoCommit(true);
+}
@@ -0,0 +1,29 @@
+#ifndef __DATABASETRANSACTION__H__
+#define __DATABASETRANSACTION__H__
+
+class GameDatabase;
+
+/**
+ * Runs every statement made while it is alive in one transaction, and rolls the transaction back
+ * if it goes out of scope without Commit being called, like when a statement throws.
+ * Inside a transaction someone else already opened, the statements become part of that transaction
+ * and committing or rolling back is left to whoever opened it.
+ */
+class DatabaseTransaction {
+public:
+	explicit DatabaseTransaction(GameDatabase& database);
+	~DatabaseTransaction();
+
+	DatabaseTransaction(const DatabaseTransaction&) = delete;
+	DatabaseTransaction& operator=(const DatabaseTransaction&) = delete;
+
+	void Commit();
+
+private:
+	GameDatabase& m_Database;
+	// Whether this guard opened the transaction, false if it is nested in another one
+	bool m_Owner = false;
+	bool m_Finished = false;
+};
+
+#endif  //!__DATABASETRANSACTION__H__
@@ -24,6 +24,7 @@
 #include "IIgnoreList.h"
 #include "IAccountsRewardCodes.h"
 #include "IBehaviors.h"
+#include "ICharSummary.h"
 
 namespace sql {
 	class Statement;
@@ -42,7 +43,7 @@ class GameDatabase :
 	public IPropertyContents, public IProperty, public IPetNames, public ICharXml,
 	public IMigrationHistory, public IUgc, public IFriends, public ICharInfo,
 	public IAccounts, public IActivityLog, public IAccountsRewardCodes, public IIgnoreList,
-	public IBehaviors {
+	public IBehaviors, public ICharSummary {
 public:
 	virtual ~GameDatabase() = default;
 	// TODO: These should be made private.
@@ -51,6 +52,7 @@ public:
 	virtual void ExecuteCustomQuery(const std::string_view query) = 0;
 	virtual sql::PreparedStatement* CreatePreppedStmt(const std::string& query) = 0;
 	virtual void Commit() = 0;
+	virtual void Rollback() = 0;
 	virtual bool GetAutoCommit() = 0;
 	virtual void SetAutoCommit(bool value) = 0;
 	virtual void DeleteCharacter(const uint32_t characterId) = 0;
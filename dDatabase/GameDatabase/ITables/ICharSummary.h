@@ -0,0 +1,37 @@
+#ifndef __ICHARSUMMARY__H__
+#define __ICHARSUMMARY__H__
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "dCommonVars.h"
+
+// The parts of a character that the character select screen shows, kept separate from the character xml
+// so the select screen does not have to load and parse the full xml of every character on an account.
+class ICharSummary {
+public:
+	struct Info {
+		uint32_t hairColor{};
+		uint32_t hairStyle{};
+		uint32_t shirtColor{};
+		uint32_t pantsColor{};
+		uint32_t leftHand{};
+		uint32_t rightHand{};
+		uint32_t eyebrows{};
+		uint32_t eyes{};
+		uint32_t mouth{};
+		LWOMAPID zoneId{};
+		LWOINSTANCEID zoneInstance{};
+		LWOCLONEID zoneClone{};
+		std::vector<LOT> equippedItems;
+	};
+
+	// Get the summary for the given character id.
+	virtual std::optional<ICharSummary::Info> GetCharacterSummary(const uint32_t charId) = 0;
+
+	// Insert or replace the summary for the given character id.
+	virtual void UpsertCharacterSummary(const uint32_t charId, const ICharSummary::Info& info) = 0;
+};
+
+#endif  //!__ICHARSUMMARY__H__
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 class ICharXml {
 public:
@@ -15,6 +16,20 @@ public:
 
 	// Insert the character xml for the given character id.
 	virtual void InsertCharacterXml(const uint32_t characterId, const std::string_view lxfml) = 0;
+
+	struct Section {
+		std::string name;
+		std::string data;
+	};
+
+	// Get all stored sections of the character document for the given character id.
+	virtual std::vector<Section> GetCharacterSections(const uint32_t charId) = 0;
+
+	// Insert or replace a section of the character document for the given character id.
+	virtual void UpsertCharacterSection(const uint32_t charId, const std::string_view name, const std::string_view data) = 0;
+
+	// Delete a section of the character document for the given character id.
+	virtual void DeleteCharacterSection(const uint32_t charId, const std::string_view name) = 0;
 };
 
 #endif  //!__ICHARXML__H__
@@ -87,6 +87,10 @@ void MySQLDatabase::Commit() {
 	con->commit();
 }
 
+void MySQLDatabase::Rollback() {
+	con->rollback();
+}
+
 bool MySQLDatabase::GetAutoCommit() {
 	// TODO This should not just access a pointer.  A future PR should update this
 	// to check for null and throw an error if the connection is not valid.
@@ -101,6 +105,8 @@ void MySQLDatabase::SetAutoCommit(bool value) {
 
 void MySQLDatabase::DeleteCharacter(const uint32_t characterId) {
 	ExecuteDelete("DELETE FROM charxml WHERE id=? LIMIT 1;", characterId);
+	ExecuteDelete("DELETE FROM charsummary WHERE id=? LIMIT 1;", characterId);
+	ExecuteDelete("DELETE FROM charsections WHERE id=?;", characterId);
 	ExecuteDelete("DELETE FROM command_log WHERE character_id=?;", characterId);
 	ExecuteDelete("DELETE FROM friends WHERE player_id=? OR friend_id=?;", characterId, characterId);
 	ExecuteDelete("DELETE FROM leaderboard WHERE character_id=?;", characterId);
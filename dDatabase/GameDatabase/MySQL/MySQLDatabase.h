@@ -31,6 +31,7 @@ public:
 
 	sql::PreparedStatement* CreatePreppedStmt(const std::string& query) override;
 	void Commit() override;
+	void Rollback() override;
 	bool GetAutoCommit() override;
 	void SetAutoCommit(bool value) override;
 	void ExecuteCustomQuery(const std::string_view query) override;
@@ -57,9 +58,14 @@ public:
 	std::optional<ICharInfo::Info> GetCharacterInfo(const std::string_view charId) override;
 	std::string GetCharacterXml(const uint32_t accountId) override;
 	void UpdateCharacterXml(const uint32_t characterId, const std::string_view lxfml) override;
+	std::optional<ICharSummary::Info> GetCharacterSummary(const uint32_t charId) override;
+	void UpsertCharacterSummary(const uint32_t charId, const ICharSummary::Info& info) override;
 	std::optional<IAccounts::Info> GetAccountInfo(const std::string_view username) override;
 	void InsertNewCharacter(const ICharInfo::Info info) override;
 	void InsertCharacterXml(const uint32_t accountId, const std::string_view lxfml) override;
+	std::vector<ICharXml::Section> GetCharacterSections(const uint32_t charId) override;
+	void UpsertCharacterSection(const uint32_t charId, const std::string_view name, const std::string_view data) override;
+	void DeleteCharacterSection(const uint32_t charId, const std::string_view name) override;
 	std::vector<uint32_t> GetAccountCharacterIds(uint32_t accountId) override;
 	void DeleteCharacter(const uint32_t characterId) override;
 	void SetCharacterName(const uint32_t characterId, const std::string_view name) override;
@@ -0,0 +1,58 @@
+#include "MySQLDatabase.h"
+
+#include "GeneralUtils.h"
+
+std::optional<ICharSummary::Info> MySQLDatabase::GetCharacterSummary(const uint32_t charId) {
+	auto result = ExecuteSelect("SELECT * FROM charsummary WHERE id = ? LIMIT 1;", charId);
+
+	if (!result->next()) {
+		return std::nullopt;
+	}
+
+	ICharSummary::Info toReturn;
+	toReturn.hairColor = result->getUInt("hair_color");
+	toReturn.hairStyle = result->getUInt("hair_style");
+	toReturn.shirtColor = result->getUInt("shirt_color");
+	toReturn.pantsColor = result->getUInt("pants_color");
+	toReturn.leftHand = result->getUInt("left_hand");
+	toReturn.rightHand = result->getUInt("right_hand");
+	toReturn.eyebrows = result->getUInt("eyebrows");
+	toReturn.eyes = result->getUInt("eyes");
+	toReturn.mouth = result->getUInt("mouth");
+	toReturn.zoneId = result->getUInt("zone_id");
+	toReturn.zoneInstance = result->getUInt("zone_instance");
+	toReturn.zoneClone = result->getUInt("zone_clone");
+
+	for (const auto& lot : GeneralUtils::SplitString(result->getString("equipped_items").c_str(), ',')) {
+		const auto parsed = GeneralUtils::TryParse<LOT>(lot);
+		if (parsed) toReturn.equippedItems.push_back(parsed.value());
+	}
+
+	return toReturn;
+}
+
+void MySQLDatabase::UpsertCharacterSummary(const uint32_t charId, const ICharSummary::Info& info) {
+	std::string equippedItems;
+	for (const auto lot : info.equippedItems) {
+		if (!equippedItems.empty()) equippedItems += ',';
+		equippedItems += std::to_string(lot);
+	}
+
+	ExecuteInsert(
+		"REPLACE INTO charsummary (id, hair_color, hair_style, shirt_color, pants_color, left_hand, right_hand, eyebrows, eyes, mouth, zone_id, zone_instance, zone_clone, equipped_items) "
+		"VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);",
+		charId,
+		info.hairColor,
+		info.hairStyle,
+		info.shirtColor,
+		info.pantsColor,
+		info.leftHand,
+		info.rightHand,
+		info.eyebrows,
+		info.eyes,
+		info.mouth,
+		static_cast<uint32_t>(info.zoneId),
+		static_cast<uint32_t>(info.zoneInstance),
+		info.zoneClone,
+		equippedItems);
+}
@@ -1,5 +1,7 @@
 #include "MySQLDatabase.h"
 
+#include <sstream>
+
 std::string MySQLDatabase::GetCharacterXml(const uint32_t charId) {
 	auto result = ExecuteSelect("SELECT xml_data FROM charxml WHERE id = ? LIMIT 1;", charId);
 
@@ -17,3 +19,33 @@ void MySQLDatabase::UpdateCharacterXml(const uint32_t charId, const std::string_
 void MySQLDatabase::InsertCharacterXml(const uint32_t characterId, const std::string_view lxfml) {
 	ExecuteInsert("INSERT INTO `charxml` (`id`, `xml_data`) VALUES (?,?)", characterId, lxfml);
 }
+
+std::vector<ICharXml::Section> MySQLDatabase::GetCharacterSections(const uint32_t charId) {
+	auto result = ExecuteSelect("SELECT section, data FROM charsections WHERE id = ?;", charId);
+
+	std::vector<ICharXml::Section> toReturn;
+	toReturn.reserve(result->rowsCount());
+	while (result->next()) {
+		ICharXml::Section section;
+		section.name = result->getString("section").c_str();
+
+		// blob is owned by the query, so we need to do a deep copy :/
+		std::unique_ptr<std::istream> blob(result->getBlob("data"));
+		std::ostringstream data;
+		data << blob->rdbuf();
+		section.data = data.str();
+		toReturn.push_back(std::move(section));
+	}
+
+	return toReturn;
+}
+
+void MySQLDatabase::UpsertCharacterSection(const uint32_t charId, const std::string_view name, const std::string_view data) {
+	std::istringstream dataStream{ std::string(data) };
+	const std::istream stream(dataStream.rdbuf());
+	ExecuteInsert("REPLACE INTO charsections (id, section, data) VALUES (?,?,?);", charId, name, &stream);
+}
+
+void MySQLDatabase::DeleteCharacterSection(const uint32_t charId, const std::string_view name) {
+	ExecuteDelete("DELETE FROM charsections WHERE id = ? AND section = ?;", charId, name);
+}
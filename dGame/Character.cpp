@@ -1,6 +1,7 @@
 #include "Character.h"
 #include "User.h"
 #include "Database.h"
+#include "DatabaseTransaction.h"
 #include "GeneralUtils.h"
 #include "Logger.h"
 #include "BitStream.h"
@@ -21,6 +22,7 @@
 #include "eObjectBits.h"
 #include "eGameMasterLevel.h"
 #include "ePlayerFlag.h"
+#include "CharacterSections.h"
 
 Character::Character(uint32_t id, User* parentUser) {
 	//First load the name, etc:
@@ -36,7 +38,7 @@ Character::~Character() {
 	m_ParentUser = nullptr;
 }
 
-void Character::UpdateInfoFromDatabase() {
+void Character::UpdateCharInfoFromDatabase() {
 	auto charInfo = Database::Get()->GetCharacterInfo(m_ID);
 
 	if (charInfo) {
@@ -47,8 +49,17 @@ void Character::UpdateInfoFromDatabase() {
 		m_PermissionMap = charInfo->permissionMap;
 	}
 
+	//Set our objectID:
+	m_ObjectID = m_ID;
+	GeneralUtils::SetBit(m_ObjectID, eObjectBits::CHARACTER);
+	GeneralUtils::SetBit(m_ObjectID, eObjectBits::PERSISTENT);
+}
+
+void Character::UpdateInfoFromDatabase() {
+	UpdateCharInfoFromDatabase();
+
 	//Load the xmlData now:
-	m_XMLData = Database::Get()->GetCharacterXml(m_ID);
+	LoadXMLDataFromDatabase();
 
 	m_ZoneID = 0; //TEMP! Set back to 0 when done. This is so we can see loading screen progress for testing.
 	m_ZoneInstanceID = 0; //These values don't really matter, these are only used on the char select screen and seem unused.
@@ -57,11 +68,6 @@ void Character::UpdateInfoFromDatabase() {
 	//Quickly and dirtly parse the xmlData to get the info we need:
 	DoQuickXMLDataParse();
 
-	//Set our objectID:
-	m_ObjectID = m_ID;
-	GeneralUtils::SetBit(m_ObjectID, eObjectBits::CHARACTER);
-	GeneralUtils::SetBit(m_ObjectID, eObjectBits::PERSISTENT);
-
 	m_OurEntity = nullptr;
 	m_BuildMode = false;
 }
@@ -70,6 +76,86 @@ void Character::UpdateFromDatabase() {
 	UpdateInfoFromDatabase();
 }
 
+void Character::LoadXMLDataFromDatabase() {
+	m_SectionHashes.clear();
+	m_XmlLoadFailed = false;
+
+	auto storedSections = Database::Get()->GetCharacterSections(m_ID);
+	if (!storedSections.empty()) {
+		CharacterSections::SectionMap sections;
+		std::map<std::string, size_t> sectionHashes;
+		for (const auto& section : storedSections) {
+			auto sectionXml = CharacterSections::Decode(section.data);
+			if (!sectionXml) {
+				// The character xml stopped being updated once the character was saved in sections, loading it would roll the character back.
+				LOG("Failed to decode section %s of character %i, the character can not be loaded until the section is repaired!", section.name.c_str(), m_ID);
+				m_XMLData.clear();
+				m_XmlLoadFailed = true;
+				return;
+			}
+
+			sectionHashes[section.name] = std::hash<std::string>{}(*sectionXml);
+			sections[section.name] = std::move(*sectionXml);
+		}
+
+		m_XMLData = CharacterSections::Join(sections);
+		m_SectionHashes = std::move(sectionHashes);
+		return;
+	}
+
+	// Characters that have never been saved in sections are loaded from their xml, every section is written on their next save.
+	m_XMLData = Database::Get()->GetCharacterXml(m_ID);
+}
+
+void Character::UpdateSummaryFromDatabase() {
+	const auto summary = Database::Get()->GetCharacterSummary(m_ID);
+
+	// Characters that have not been saved since summaries were added need one built from their xml once.
+	if (!summary) {
+		UpdateFromDatabase();
+		WriteSummaryToDatabase();
+		return;
+	}
+
+	UpdateCharInfoFromDatabase();
+
+	m_HairColor = summary->hairColor;
+	m_HairStyle = summary->hairStyle;
+	m_ShirtColor = summary->shirtColor;
+	m_PantsColor = summary->pantsColor;
+	m_LeftHand = summary->leftHand;
+	m_RightHand = summary->rightHand;
+	m_Eyebrows = summary->eyebrows;
+	m_Eyes = summary->eyes;
+	m_Mouth = summary->mouth;
+	m_ZoneID = summary->zoneId;
+	m_ZoneInstanceID = summary->zoneInstance;
+	m_ZoneCloneID = summary->zoneClone;
+	m_EquippedItems = summary->equippedItems;
+
+	m_OurEntity = nullptr;
+	m_BuildMode = false;
+}
+
+void Character::WriteSummaryToDatabase() const {
+	ICharSummary::Info summary;
+	summary.hairColor = m_HairColor;
+	summary.hairStyle = m_HairStyle;
+	summary.shirtColor = m_ShirtColor;
+	summary.pantsColor = m_PantsColor;
+	summary.leftHand = m_LeftHand;
+	summary.rightHand = m_RightHand;
+	summary.eyebrows = m_Eyebrows;
+	summary.eyes = m_Eyes;
+	summary.mouth = m_Mouth;
+	summary.zoneId = m_ZoneID;
+	summary.zoneInstance = m_ZoneInstanceID;
+	summary.zoneClone = m_ZoneCloneID;
+	summary.equippedItems = m_EquippedItems;
+
+	Database::Get()->UpsertCharacterSummary(m_ID, summary);
+}
+
 void Character::DoQuickXMLDataParse() {
 	if (m_XMLData.size() == 0) return;
 
@@ -113,6 +199,8 @@ void Character::DoQuickXMLDataParse() {
 		return;
 	}
 
+	m_EquippedItems.clear();
+
 	while (bag != nullptr) {
 		auto* sib = bag->FirstChildElement();
 
@@ -248,6 +336,10 @@ void Character::SaveXMLToDatabase() {
 			character->SetAttribute("lzid", lzidConcat);
 			character->SetAttribute("lnzid", GetLastNonInstanceZoneID());
 
+			m_ZoneID = zoneInfo.GetMapID();
+			m_ZoneInstanceID = zoneInfo.GetInstanceID();
+			m_ZoneCloneID = zoneInfo.GetCloneID();
+
 			//Darwin's backup:
 			character->SetAttribute("lwid", Game::server->GetZoneID());
 
@@ -308,6 +400,16 @@ void Character::SaveXMLToDatabase() {
 
 	WriteToDatabase();
 
+	auto* inventoryComponent = m_OurEntity->GetComponent<InventoryComponent>();
+	if (inventoryComponent) {
+		m_EquippedItems.clear();
+		for (const auto& [location, item] : inventoryComponent->GetEquippedItems()) {
+			m_EquippedItems.push_back(item.lot);
+		}
+	}
+
+	WriteSummaryToDatabase();
+
 	//For metrics, log the time it took to save:
 	auto end = std::chrono::system_clock::now();
 	std::chrono::duration<double> elapsed = end - start;
@@ -332,12 +434,44 @@ void Character::SetIsNewLogin() {
 }
 
 void Character::WriteToDatabase() {
-	//Dump our xml into m_XMLData:
-	tinyxml2::XMLPrinter printer(0, true, 0);
-	m_Doc.Print(&printer);
+	if (m_XmlLoadFailed) {
+		LOG("%i:%s failed to load from the database, not saving!", this->GetID(), this->GetName().c_str());
+		return;
+	}
 
-	//Finally, save to db:
-	Database::Get()->UpdateCharacterXml(m_ID, printer.CStr());
+	const auto sections = CharacterSections::Split(m_Doc);
+	if (sections.empty()) {
+		LOG("%i:%s has no obj element in its xml, not saving!", this->GetID(), this->GetName().c_str());
+		return;
+	}
+
+	//Only write the sections that changed since they were last loaded or saved:
+	std::map<std::string, size_t> sectionHashes;
+	DatabaseTransaction transaction(*Database::Get());
+
+	for (const auto& [name, sectionXml] : sections) {
+		const auto hash = std::hash<std::string>{}(sectionXml);
+		sectionHashes[name] = hash;
+
+		const auto previous = m_SectionHashes.find(name);
+		if (previous != m_SectionHashes.end() && previous->second == hash) continue;
+
+		const auto encoded = CharacterSections::Encode(sectionXml);
+		if (!encoded) {
+			LOG("Failed to encode section %s of %i:%s, not saving!", name.c_str(), this->GetID(), this->GetName().c_str());
+			return;
+		}
+
+		Database::Get()->UpsertCharacterSection(m_ID, name, *encoded);
+	}
+
+	for (const auto& [name, hash] : m_SectionHashes) {
+		if (!sections.contains(name)) Database::Get()->DeleteCharacterSection(m_ID, name);
+	}
+
+	transaction.Commit();
+
+	m_SectionHashes = std::move(sectionHashes);
 }
 
 void Character::SetPlayerFlag(const uint32_t flagId, const bool value) {
@@ -383,6 +517,8 @@ void Character::SetPlayerFlag(const uint32_t flagId, const bool value) {
 		}
 	}
 
+	ClearPreconditionCache();
+
 	// Notify the client that a flag has changed server-side
 	GameMessages::SendNotifyClientFlagChange(m_ObjectID, flagId, value, m_ParentUser->GetSystemAddress());
 }
@@ -402,6 +538,13 @@ bool Character::GetPlayerFlag(const uint32_t flagId) const {
 	return false; //by def, return false.
 }
 
+std::optional<bool> Character::GetCachedPrecondition(const uint32_t preconditionId) const {
+	const auto it = m_PreconditionResults.find(preconditionId);
+	if (it == m_PreconditionResults.end()) return std::nullopt;
+
+	return it->second;
+}
+
 void Character::SetRetroactiveFlags() {
 	// Retroactive check for if player has joined a faction to set their 'joined a faction' flag to true.
 	if (GetPlayerFlag(ePlayerFlag::VENTURE_FACTION) || GetPlayerFlag(ePlayerFlag::ASSEMBLY_FACTION) || GetPlayerFlag(ePlayerFlag::PARADOX_FACTION) || GetPlayerFlag(ePlayerFlag::SENTINEL_FACTION)) {
@@ -6,6 +6,7 @@
 #include "tinyxml2.h"
 #include <unordered_map>
 #include <map>
+#include <optional>
 
 #include "NiPoint3.h"
 #include "NiQuaternion.h"
@@ -33,10 +34,24 @@ public:
 	void SaveXMLToDatabase();
 	void UpdateFromDatabase();
 
+	/**
+	 * Loads only what the character select screen needs from the character summary.
+	 * The character xml is not loaded, so UpdateFromDatabase must be called before the xml is used.
+	 */
+	void UpdateSummaryFromDatabase();
+
+	/**
+	 * Writes the character select screen information of this character to the database.
+	 */
+	void WriteSummaryToDatabase() const;
+
 	void SaveXmlRespawnCheckpoints();
 	void LoadXmlRespawnCheckpoints();
 
 	const std::string& GetXMLData() const { return m_XMLData; }
+
+	// Whether the stored character document could not be read, such a character must not be played or saved
+	bool GetXmlLoadFailed() const { return m_XmlLoadFailed; }
 	const tinyxml2::XMLDocument& GetXMLDoc() const { return m_Doc; }
 
 	/**
@@ -424,6 +439,25 @@ public:
 	 */
 	bool GetPlayerFlag(uint32_t flagId) const;
 
+	/**
+	 * Gets the cached result of a precondition that only depends on flags, missions and the level of this character
+	 * @param preconditionId the ID of the precondition
+	 * @return the cached result, or nothing if it was not checked since the last change
+	 */
+	std::optional<bool> GetCachedPrecondition(uint32_t preconditionId) const;
+
+	/**
+	 * Caches the result of a precondition that only depends on flags, missions and the level of this character
+	 * @param preconditionId the ID of the precondition
+	 * @param result the result of the precondition
+	 */
+	void CachePrecondition(uint32_t preconditionId, bool result) { m_PreconditionResults.insert_or_assign(preconditionId, result); }
+
+	/**
+	 * Forgets all cached precondition results, called whenever flags, missions or the level of this character change
+	 */
+	void ClearPreconditionCache() { m_PreconditionResults.clear(); }
+
 	/**
 	 * Notifies the character that they're now muted
 	 */
@@ -461,6 +495,8 @@ public:
 
 private:
 	void UpdateInfoFromDatabase();
+	void UpdateCharInfoFromDatabase();
+	void LoadXMLDataFromDatabase();
 	/**
 	 * The ID of this character. First 32 bits of the ObjectID.
 	 */
@@ -590,6 +626,17 @@ private:
 	 */
 	std::string m_XMLData;
 
+	/**
+	 * Hashes of the character document sections as they are currently stored in the database,
+	 * used to only write the sections that changed. Empty if the character has not been stored in sections yet.
+	 */
+	std::map<std::string, size_t> m_SectionHashes;
+
+	/**
+	 * Whether a stored section of the character document could not be decoded on the last load
+	 */
+	bool m_XmlLoadFailed = false;
+
 	/**
 	 * The last zone visited by the character that was not an instance zone
 	 */
@@ -620,6 +667,11 @@ private:
 	 */
 	std::unordered_map<uint32_t, uint64_t> m_PlayerFlags;
 
+	/**
+	 * Cached results of preconditions that only depend on flags, missions and the level, mapped by precondition ID
+	 */
+	std::unordered_map<uint32_t, bool> m_PreconditionResults;
+
 	/**
 	 * The character XML belonging to this character
 	 */
@@ -0,0 +1,30 @@
+#ifndef __COMPONENTSLOTS__H__
+#define __COMPONENTSLOTS__H__
+
+#include <cstdint>
+
+#include "eReplicaComponentType.h"
+
+/**
+ * Maps every eReplicaComponentType to a dense slot index, so an entity can find its components
+ * with an array lookup instead of hashing the component type.
+ */
+namespace ComponentSlots {
+	// Every type up to CULLING_PLANE maps to itself, DESTROYABLE gets the slot after it.
+	constexpr uint32_t COUNT = static_cast<uint32_t>(eReplicaComponentType::CULLING_PLANE) + 2;
+
+	// Returned for types that have no slot
+	constexpr uint32_t INVALID = COUNT;
+
+	// Marks a slot that has no component in Entity's slot table
+	constexpr uint8_t EMPTY = UINT8_MAX;
+
+	constexpr uint32_t GetSlot(const eReplicaComponentType type) {
+		if (type == eReplicaComponentType::DESTROYABLE) return COUNT - 1;
+
+		const auto slot = static_cast<uint32_t>(type);
+		return slot < COUNT - 1 ? slot : INVALID;
+	}
+};
+
+#endif  //!__COMPONENTSLOTS__H__
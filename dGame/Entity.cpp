@@ -26,6 +26,7 @@
 #include "PositionUpdate.h"
 #include "eChatMessageType.h"
 #include "PlayerManager.h"
+#include "EntityArchetype.h"
 
 //Component includes:
 #include "Component.h"
@@ -110,6 +111,7 @@ Entity::Entity(const LWOOBJID& objectID, EntityInfo info, User* parentUser, Enti
 	m_ScheduleKiller = nullptr;
 	m_TargetsInPhantom = {};
 	m_Components = {};
+	m_ComponentSlots.fill(ComponentSlots::EMPTY);
 	m_DieCallbacks = {};
 	m_PhantomCollisionCallbacks = {};
 	m_IsParentChildDirty = true;
@@ -166,13 +168,14 @@ Entity::~Entity() {
 	CancelAllTimers();
 	CancelCallbackTimers();
 
-	const auto components = m_Components;
+	// Components are removed one at a time, so the ones deleted later no longer see the ones deleted before them
+	for (auto& [componentType, component] : m_Components) {
+		delete component;
 
-	for (const auto& pair : components) {
-		delete pair.second;
-
-		m_Components.erase(pair.first);
+		m_ComponentSlots[ComponentSlots::GetSlot(componentType)] = ComponentSlots::EMPTY;
+		component = nullptr;
 	}
+	m_Components.clear();
 
 	for (auto child : m_ChildEntities) {
 		if (child) child->RemoveParent();
@@ -213,15 +216,15 @@ void Entity::Initialize() {
 		m_ParentEntity->AddChild(this);
 	}
 
-	// Get the registry table
-	CDComponentsRegistryTable* compRegistryTable = CDClientManager::GetTable<CDComponentsRegistryTable>();
+	// Everything about our LOT that is the same for every spawn
+	const auto& archetype = EntityArchetype::Get(m_TemplateID);
 
 	/**
 	 * Special case for BBB models. They have components not corresponding to the registry.
 	 */
 
 	if (m_TemplateID == 14) {
-		const auto simplePhysicsComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SIMPLE_PHYSICS);
+		const auto simplePhysicsComponentID = archetype.GetComponentId(eReplicaComponentType::SIMPLE_PHYSICS);
 
 		AddComponent<SimplePhysicsComponent>(simplePhysicsComponentID);
 
@@ -248,42 +251,42 @@ void Entity::Initialize() {
 		AddComponent<MissionComponent>()->LoadFromXml(m_Character->GetXMLDoc());
 	}
 
-	uint32_t petComponentId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PET);
+	uint32_t petComponentId = archetype.GetComponentId(eReplicaComponentType::PET);
 	if (petComponentId > 0) {
 		AddComponent<PetComponent>(petComponentId);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MINI_GAME_CONTROL) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::MINI_GAME_CONTROL) > 0) {
 		AddComponent<MiniGameControlComponent>();
 	}
 
-	uint32_t possessableComponentId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::POSSESSABLE);
+	uint32_t possessableComponentId = archetype.GetComponentId(eReplicaComponentType::POSSESSABLE);
 	if (possessableComponentId > 0) {
 		AddComponent<PossessableComponent>(possessableComponentId);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MODULE_ASSEMBLY) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::MODULE_ASSEMBLY) > 0) {
 		AddComponent<ModuleAssemblyComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RACING_STATS) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::RACING_STATS) > 0) {
 		AddComponent<RacingStatsComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::LUP_EXHIBIT, -1) >= 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::LUP_EXHIBIT, -1) >= 0) {
 		AddComponent<LUPExhibitComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RACING_CONTROL) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::RACING_CONTROL) > 0) {
 		AddComponent<RacingControlComponent>();
 	}
 
-	const auto propertyEntranceComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PROPERTY_ENTRANCE);
+	const auto propertyEntranceComponentID = archetype.GetComponentId(eReplicaComponentType::PROPERTY_ENTRANCE);
 	if (propertyEntranceComponentID > 0) {
 		AddComponent<PropertyEntranceComponent>(propertyEntranceComponentID);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::CONTROLLABLE_PHYSICS) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::CONTROLLABLE_PHYSICS) > 0) {
 		auto* controllablePhysics = AddComponent<ControllablePhysicsComponent>();
 
 		if (m_Character) {
@@ -322,36 +325,36 @@ void Entity::Initialize() {
 	// If an entity is marked a phantom, simple physics is made into phantom phyics.
 	bool markedAsPhantom = GetVar<bool>(u"markedAsPhantom");
 
-	const auto simplePhysicsComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SIMPLE_PHYSICS);
+	const auto simplePhysicsComponentID = archetype.GetComponentId(eReplicaComponentType::SIMPLE_PHYSICS);
 	if (!markedAsPhantom && simplePhysicsComponentID > 0) {
 		AddComponent<SimplePhysicsComponent>(simplePhysicsComponentID);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RIGID_BODY_PHANTOM_PHYSICS) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::RIGID_BODY_PHANTOM_PHYSICS) > 0) {
 		AddComponent<RigidbodyPhantomPhysicsComponent>();
 	}
 
-	if (markedAsPhantom || compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PHANTOM_PHYSICS) > 0) {
+	if (markedAsPhantom || archetype.GetComponentId(eReplicaComponentType::PHANTOM_PHYSICS) > 0) {
 		AddComponent<PhantomPhysicsComponent>()->SetPhysicsEffectActive(false);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::HAVOK_VEHICLE_PHYSICS) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::HAVOK_VEHICLE_PHYSICS) > 0) {
 		auto* havokVehiclePhysicsComponent = AddComponent<HavokVehiclePhysicsComponent>();
 		havokVehiclePhysicsComponent->SetPosition(m_DefaultPosition);
 		havokVehiclePhysicsComponent->SetRotation(m_DefaultRotation);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SOUND_TRIGGER, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::SOUND_TRIGGER, -1) != -1) {
 		AddComponent<SoundTriggerComponent>();
-	} else if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RACING_SOUND_TRIGGER, -1) != -1) {
+	} else if (archetype.GetComponentId(eReplicaComponentType::RACING_SOUND_TRIGGER, -1) != -1) {
 		AddComponent<RacingSoundTriggerComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::BUFF) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::BUFF) > 0) {
 		AddComponent<BuffComponent>();
 	}
 
-	int collectibleComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::COLLECTIBLE);
+	int collectibleComponentID = archetype.GetComponentId(eReplicaComponentType::COLLECTIBLE);
 
 	if (collectibleComponentID > 0) {
 		AddComponent<CollectibleComponent>(GetVarAs<int32_t>(u"collectible_id"));
@@ -360,16 +363,15 @@ void Entity::Initialize() {
 	/**
 	 * Multiple components require the destructible component.
 	 */
-	int buffComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::BUFF);
-	int quickBuildComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::QUICK_BUILD);
+	int buffComponentID = archetype.GetComponentId(eReplicaComponentType::BUFF);
+	int quickBuildComponentID = archetype.GetComponentId(eReplicaComponentType::QUICK_BUILD);
 
 	int componentID = -1;
 	if (collectibleComponentID > 0) componentID = collectibleComponentID;
 	if (quickBuildComponentID > 0) componentID = quickBuildComponentID;
 	if (buffComponentID > 0) componentID = buffComponentID;
 
-	CDDestructibleComponentTable* destCompTable = CDClientManager::GetTable<CDDestructibleComponentTable>();
-	std::vector<CDDestructibleComponent> destCompData = destCompTable->Query([=](CDDestructibleComponent entry) { return (entry.id == componentID); });
+	const auto& destCompData = archetype.GetDestructible();
 
 	bool isSmashable = GetVarAs<int32_t>(u"is_smashable") != 0;
 	if (buffComponentID > 0 || collectibleComponentID > 0 || isSmashable) {
@@ -378,38 +380,30 @@ void Entity::Initialize() {
 			comp->LoadFromXml(m_Character->GetXMLDoc());
 		} else {
 			if (componentID > 0) {
-				std::vector<CDDestructibleComponent> destCompData = destCompTable->Query([=](CDDestructibleComponent entry) { return (entry.id == componentID); });
-
-				if (destCompData.size() > 0) {
-					if (HasComponent(eReplicaComponentType::RACING_STATS)) {
-						destCompData[0].imagination = 60;
-					}
+				if (destCompData) {
+					// A race car has 60 imagination
+					const uint32_t imagination = HasComponent(eReplicaComponentType::RACING_STATS) ? 60 : destCompData->imagination;
 
-					comp->SetHealth(destCompData[0].life);
-					comp->SetImagination(destCompData[0].imagination);
-					comp->SetArmor(destCompData[0].armor);
+					comp->SetHealth(destCompData->life);
+					comp->SetImagination(imagination);
+					comp->SetArmor(destCompData->armor);
 
-					comp->SetMaxHealth(destCompData[0].life);
-					comp->SetMaxImagination(destCompData[0].imagination);
-					comp->SetMaxArmor(destCompData[0].armor);
-					comp->SetDeathBehavior(destCompData[0].death_behavior);
+					comp->SetMaxHealth(destCompData->life);
+					comp->SetMaxImagination(imagination);
+					comp->SetMaxArmor(destCompData->armor);
+					comp->SetDeathBehavior(destCompData->death_behavior);
 
-					comp->SetIsSmashable(destCompData[0].isSmashable);
+					comp->SetIsSmashable(destCompData->isSmashable);
 
-					comp->SetLootMatrixID(destCompData[0].LootMatrixIndex);
-					Loot::CacheMatrix(destCompData[0].LootMatrixIndex);
+					comp->SetLootMatrixID(destCompData->LootMatrixIndex);
+					Loot::CacheMatrix(destCompData->LootMatrixIndex);
 
 					// Now get currency information
-					uint32_t npcMinLevel = destCompData[0].level;
-					uint32_t currencyIndex = destCompData[0].CurrencyIndex;
-
-					CDCurrencyTableTable* currencyTable = CDClientManager::GetTable<CDCurrencyTableTable>();
-					std::vector<CDCurrencyTable> currencyValues = currencyTable->Query([=](CDCurrencyTable entry) { return (entry.currencyIndex == currencyIndex && entry.npcminlevel == npcMinLevel); });
-
-					if (currencyValues.size() > 0) {
+					const auto& currency = archetype.GetCurrency();
+					if (currency) {
 						// Set the coins
-						comp->SetMinCoins(currencyValues[0].minvalue);
-						comp->SetMaxCoins(currencyValues[0].maxvalue);
+						comp->SetMinCoins(currency->first);
+						comp->SetMaxCoins(currency->second);
 					}
 
 					// extraInfo overrides. Client ORs the database smashable and the luz smashable.
@@ -432,13 +426,13 @@ void Entity::Initialize() {
 			}
 		}
 
-		if (destCompData.size() > 0) {
-			comp->AddFaction(destCompData[0].faction);
-			std::stringstream ss(destCompData[0].factionList);
+		if (destCompData) {
+			comp->AddFaction(destCompData->faction);
+			std::stringstream ss(destCompData->factionList);
 			std::string token;
 
 			while (std::getline(ss, token, ',')) {
-				if (std::stoi(token) == destCompData[0].faction) continue;
+				if (std::stoi(token) == destCompData->faction) continue;
 
 				if (token != "") {
 					comp->AddFaction(std::stoi(token));
@@ -460,7 +454,7 @@ void Entity::Initialize() {
 		}
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::CHARACTER) > 0 || m_Character) {
+	if (archetype.GetComponentId(eReplicaComponentType::CHARACTER) > 0 || m_Character) {
 		// Character Component always has a possessor, level, and forced movement components
 		AddComponent<PossessorComponent>();
 
@@ -475,11 +469,11 @@ void Entity::Initialize() {
 		AddComponent<GhostComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::INVENTORY) > 0 || m_Character) {
+	if (archetype.GetComponentId(eReplicaComponentType::INVENTORY) > 0 || m_Character) {
 		AddComponent<InventoryComponent>();
 	}
 	// if this component exists, then we initialize it. it's value is always 0
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MULTI_ZONE_ENTRANCE, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::MULTI_ZONE_ENTRANCE, -1) != -1) {
 		AddComponent<MultiZoneEntranceComponent>();
 	}
 
@@ -487,17 +481,18 @@ void Entity::Initialize() {
 	 * This is a bit of a mess
 	 */
 
-	CDScriptComponentTable* scriptCompTable = CDClientManager::GetTable<CDScriptComponentTable>();
-	int32_t scriptComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SCRIPT, -1);
+	int32_t scriptComponentID = archetype.GetComponentId(eReplicaComponentType::SCRIPT, -1);
 
 	std::string scriptName = "";
 	bool client = false;
 	if (scriptComponentID > 0 || m_Character) {
 		std::string clientScriptName;
 		if (!m_Character) {
-			CDScriptComponent scriptCompData = scriptCompTable->GetByID(scriptComponentID);
-			scriptName = scriptCompData.script_name;
-			clientScriptName = scriptCompData.client_script_name;
+			const auto& scriptCompData = archetype.GetScript();
+			if (scriptCompData) {
+				scriptName = scriptCompData->script_name;
+				clientScriptName = scriptCompData->client_script_name;
+			}
 		} else {
 			scriptName = "";
 		}
@@ -542,35 +537,34 @@ void Entity::Initialize() {
 
 		if (zoneData != nullptr) {
 			int zoneScriptID = zoneData->scriptID;
-			CDScriptComponent zoneScriptData = scriptCompTable->GetByID(zoneScriptID);
+			CDScriptComponent zoneScriptData = CDClientManager::GetTable<CDScriptComponentTable>()->GetByID(zoneScriptID);
 			AddComponent<ScriptComponent>(zoneScriptData.script_name, true);
 		}
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SKILL, -1) != -1 || m_Character) {
+	if (archetype.GetComponentId(eReplicaComponentType::SKILL, -1) != -1 || m_Character) {
 		AddComponent<SkillComponent>();
 	}
 
-	const auto combatAiId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::BASE_COMBAT_AI);
+	const auto combatAiId = archetype.GetComponentId(eReplicaComponentType::BASE_COMBAT_AI);
 	if (combatAiId > 0) {
 		AddComponent<BaseCombatAIComponent>(combatAiId);
 	}
 
-	if (int componentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::QUICK_BUILD) > 0) {
+	if (int componentID = archetype.GetComponentId(eReplicaComponentType::QUICK_BUILD) > 0) {
 		auto* quickBuildComponent = AddComponent<QuickBuildComponent>();
 
-		CDRebuildComponentTable* rebCompTable = CDClientManager::GetTable<CDRebuildComponentTable>();
-		std::vector<CDRebuildComponent> rebCompData = rebCompTable->Query([=](CDRebuildComponent entry) { return (entry.id == quickBuildComponentID); });
+		const auto& rebCompData = archetype.GetQuickBuild();
 
-		if (rebCompData.size() > 0) {
-			quickBuildComponent->SetResetTime(rebCompData[0].reset_time);
-			quickBuildComponent->SetCompleteTime(rebCompData[0].complete_time);
-			quickBuildComponent->SetTakeImagination(rebCompData[0].take_imagination);
-			quickBuildComponent->SetInterruptible(rebCompData[0].interruptible);
-			quickBuildComponent->SetSelfActivator(rebCompData[0].self_activator);
-			quickBuildComponent->SetActivityId(rebCompData[0].activityID);
-			quickBuildComponent->SetPostImaginationCost(rebCompData[0].post_imagination_cost);
-			quickBuildComponent->SetTimeBeforeSmash(rebCompData[0].time_before_smash);
+		if (rebCompData) {
+			quickBuildComponent->SetResetTime(rebCompData->reset_time);
+			quickBuildComponent->SetCompleteTime(rebCompData->complete_time);
+			quickBuildComponent->SetTakeImagination(rebCompData->take_imagination);
+			quickBuildComponent->SetInterruptible(rebCompData->interruptible);
+			quickBuildComponent->SetSelfActivator(rebCompData->self_activator);
+			quickBuildComponent->SetActivityId(rebCompData->activityID);
+			quickBuildComponent->SetPostImaginationCost(rebCompData->post_imagination_cost);
+			quickBuildComponent->SetTimeBeforeSmash(rebCompData->time_before_smash);
 
 			const auto rebuildResetTime = GetVar<float>(u"rebuild_reset_time");
 
@@ -605,50 +599,50 @@ void Entity::Initialize() {
 		}
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SWITCH, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::SWITCH, -1) != -1) {
 		AddComponent<SwitchComponent>();
 	}
 
-	if ((compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::VENDOR) > 0)) {
+	if ((archetype.GetComponentId(eReplicaComponentType::VENDOR) > 0)) {
 		AddComponent<VendorComponent>();
-	} else if ((compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::DONATION_VENDOR, -1) != -1)) {
+	} else if ((archetype.GetComponentId(eReplicaComponentType::DONATION_VENDOR, -1) != -1)) {
 		AddComponent<DonationVendorComponent>();
-	} else if ((compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::ACHIEVEMENT_VENDOR, -1) != -1)) {
+	} else if ((archetype.GetComponentId(eReplicaComponentType::ACHIEVEMENT_VENDOR, -1) != -1)) {
 		AddComponent<AchievementVendorComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PROPERTY_VENDOR, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::PROPERTY_VENDOR, -1) != -1) {
 		AddComponent<PropertyVendorComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PROPERTY_MANAGEMENT, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::PROPERTY_MANAGEMENT, -1) != -1) {
 		AddComponent<PropertyManagementComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::BOUNCER, -1) != -1) { // you have to determine it like this because all bouncers have a componentID of 0
+	if (archetype.GetComponentId(eReplicaComponentType::BOUNCER, -1) != -1) { // you have to determine it like this because all bouncers have a componentID of 0
 		AddComponent<BouncerComponent>();
 	}
 
-	int32_t renderComponentId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RENDER);
+	int32_t renderComponentId = archetype.GetComponentId(eReplicaComponentType::RENDER);
 	if ((renderComponentId > 0 && m_TemplateID != 2365) || m_Character) {
 		AddComponent<RenderComponent>(renderComponentId);
 	}
 
-	if ((compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MISSION_OFFER) > 0) || m_Character) {
+	if ((archetype.GetComponentId(eReplicaComponentType::MISSION_OFFER) > 0) || m_Character) {
 		AddComponent<MissionOfferComponent>(m_TemplateID);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::BUILD_BORDER, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::BUILD_BORDER, -1) != -1) {
 		AddComponent<BuildBorderComponent>();
 	}
 
 	// Scripted activity component
-	int scriptedActivityID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SCRIPTED_ACTIVITY, -1);
+	int scriptedActivityID = archetype.GetComponentId(eReplicaComponentType::SCRIPTED_ACTIVITY, -1);
 	if ((scriptedActivityID != -1)) {
 		AddComponent<ScriptedActivityComponent>(scriptedActivityID);
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MODEL, -1) != -1 && !GetComponent<PetComponent>()) {
+	if (archetype.GetComponentId(eReplicaComponentType::MODEL, -1) != -1 && !GetComponent<PetComponent>()) {
 		AddComponent<ModelComponent>()->LoadBehaviors();
 		if (!HasComponent(eReplicaComponentType::DESTROYABLE)) {
 			auto* destroyableComponent = AddComponent<DestroyableComponent>();
@@ -660,43 +654,42 @@ void Entity::Initialize() {
 	}
 
 	PetComponent* petComponent;
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::ITEM) > 0 && !TryGetComponent(eReplicaComponentType::PET, petComponent) && !HasComponent(eReplicaComponentType::MODEL)) {
+	if (archetype.GetComponentId(eReplicaComponentType::ITEM) > 0 && !TryGetComponent(eReplicaComponentType::PET, petComponent) && !HasComponent(eReplicaComponentType::MODEL)) {
 		AddComponent<ItemComponent>();
 	}
 
 	// Shooting gallery component
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::SHOOTING_GALLERY) > 0) {
+	if (archetype.GetComponentId(eReplicaComponentType::SHOOTING_GALLERY) > 0) {
 		AddComponent<ShootingGalleryComponent>();
 	}
 
-	if (compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PROPERTY, -1) != -1) {
+	if (archetype.GetComponentId(eReplicaComponentType::PROPERTY, -1) != -1) {
 		AddComponent<PropertyComponent>();
 	}
 
-	const int rocketId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::ROCKET_LAUNCH);
+	const int rocketId = archetype.GetComponentId(eReplicaComponentType::ROCKET_LAUNCH);
 	if ((rocketId > 0)) {
 		AddComponent<RocketLaunchpadControlComponent>(rocketId);
 	}
 
-	const int32_t railComponentID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::RAIL_ACTIVATOR);
+	const int32_t railComponentID = archetype.GetComponentId(eReplicaComponentType::RAIL_ACTIVATOR);
 	if (railComponentID > 0) {
 		AddComponent<RailActivatorComponent>(railComponentID);
 	}
 
-	int movementAIID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MOVEMENT_AI);
+	int movementAIID = archetype.GetComponentId(eReplicaComponentType::MOVEMENT_AI);
 	if (movementAIID > 0) {
-		CDMovementAIComponentTable* moveAITable = CDClientManager::GetTable<CDMovementAIComponentTable>();
-		std::vector<CDMovementAIComponent> moveAIComp = moveAITable->Query([=](CDMovementAIComponent entry) {return (entry.id == movementAIID); });
+		const auto& moveAIComp = archetype.GetMovementAI();
 
-		if (moveAIComp.size() > 0) {
+		if (moveAIComp) {
 			MovementAIInfo moveInfo = MovementAIInfo();
 
-			moveInfo.movementType = moveAIComp[0].MovementType;
-			moveInfo.wanderChance = moveAIComp[0].WanderChance;
-			moveInfo.wanderRadius = moveAIComp[0].WanderRadius;
-			moveInfo.wanderSpeed = moveAIComp[0].WanderSpeed;
-			moveInfo.wanderDelayMax = moveAIComp[0].WanderDelayMax;
-			moveInfo.wanderDelayMin = moveAIComp[0].WanderDelayMin;
+			moveInfo.movementType = moveAIComp->MovementType;
+			moveInfo.wanderChance = moveAIComp->WanderChance;
+			moveInfo.wanderRadius = moveAIComp->WanderRadius;
+			moveInfo.wanderSpeed = moveAIComp->WanderSpeed;
+			moveInfo.wanderDelayMax = moveAIComp->WanderDelayMax;
+			moveInfo.wanderDelayMin = moveAIComp->WanderDelayMin;
 
 			bool useWanderDB = GetVar<bool>(u"usewanderdb");
 
@@ -747,19 +740,17 @@ void Entity::Initialize() {
 		}
 	} else {
 		// else we still need to setup moving platform if it has a moving platform comp but no path
-		int32_t movingPlatformComponentId = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::MOVING_PLATFORM, -1);
+		int32_t movingPlatformComponentId = archetype.GetComponentId(eReplicaComponentType::MOVING_PLATFORM, -1);
 		if (movingPlatformComponentId >= 0) {
 			AddComponent<MovingPlatformComponent>(pathName);
 		}
 	}
 
-	int proximityMonitorID = compRegistryTable->GetByIDAndType(m_TemplateID, eReplicaComponentType::PROXIMITY_MONITOR);
+	int proximityMonitorID = archetype.GetComponentId(eReplicaComponentType::PROXIMITY_MONITOR);
 	if (proximityMonitorID > 0) {
-		CDProximityMonitorComponentTable* proxCompTable = CDClientManager::GetTable<CDProximityMonitorComponentTable>();
-		std::vector<CDProximityMonitorComponent> proxCompData = proxCompTable->Query([=](CDProximityMonitorComponent entry) { return (entry.id == proximityMonitorID); });
-		if (proxCompData.size() > 0) {
-			std::vector<std::string> proximityStr = GeneralUtils::SplitString(proxCompData[0].Proximities, ',');
-			AddComponent<ProximityMonitorComponent>(std::stoi(proximityStr[0]), std::stoi(proximityStr[1]));
+		const auto& proximities = archetype.GetProximities();
+		if (proximities) {
+			AddComponent<ProximityMonitorComponent>(proximities->first, proximities->second);
 		}
 	}
 
@@ -826,20 +817,6 @@ bool Entity::operator!=(const Entity& other) const {
 	return other.m_ObjectID != m_ObjectID;
 }
 
-Component* Entity::GetComponent(eReplicaComponentType componentID) const {
-	const auto& index = m_Components.find(componentID);
-
-	if (index == m_Components.end()) {
-		return nullptr;
-	}
-
-	return index->second;
-}
-
-bool Entity::HasComponent(const eReplicaComponentType componentId) const {
-	return m_Components.find(componentId) != m_Components.end();
-}
-
 void Entity::Subscribe(LWOOBJID scriptObjId, CppScripts::Script* scriptToAdd, const std::string& notificationName) {
 	if (notificationName == "HitOrHealResult" || notificationName == "Hit") {
 		auto* destroyableComponent = GetComponent<DestroyableComponent>();
@@ -869,6 +846,7 @@ void Entity::SetProximityRadius(dpEntity* entity, std::string name) {
 
 void Entity::SetGMLevel(eGameMasterLevel value) {
 	m_GMLevel = value;
+	InvalidateConstruction();
 	if (m_Character) m_Character->SetGMLevel(value);
 
 	auto* characterComponent = GetComponent<CharacterComponent>();
@@ -1019,6 +997,27 @@ void Entity::WriteBaseReplicaData(RakNet::BitStream& outBitStream, eReplicaPacke
 	}
 }
 
+void Entity::InvalidateConstruction() const {
+	m_CachedConstruction.reset();
+}
+
+bool Entity::CanCacheConstruction() const {
+	// These write state on construction that changes without a serialization, or change too often to be worth caching
+	return !IsPlayer() &&
+		!HasComponent(eReplicaComponentType::CONTROLLABLE_PHYSICS) &&
+		!HasComponent(eReplicaComponentType::MOVEMENT_AI) &&
+		!HasComponent(eReplicaComponentType::BASE_COMBAT_AI) &&
+		!HasComponent(eReplicaComponentType::MOVING_PLATFORM) &&
+		!HasComponent(eReplicaComponentType::QUICK_BUILD) &&
+		!HasComponent(eReplicaComponentType::SCRIPTED_ACTIVITY) &&
+		!HasComponent(eReplicaComponentType::SHOOTING_GALLERY) &&
+		!HasComponent(eReplicaComponentType::RACING_CONTROL) &&
+		!HasComponent(eReplicaComponentType::PET) &&
+		!HasComponent(eReplicaComponentType::MODEL) &&
+		!HasComponent(eReplicaComponentType::POSSESSABLE) &&
+		!HasComponent(eReplicaComponentType::HAVOK_VEHICLE_PHYSICS);
+}
+
 void Entity::WriteComponents(RakNet::BitStream& outBitStream, eReplicaPacketType packetType) {
 
 	/**
@@ -1316,10 +1315,12 @@ void Entity::Update(const float deltaTime) {
 
 	GetScript()->OnUpdate(this);
 
-	for (const auto& pair : m_Components) {
-		if (pair.second == nullptr) continue;
+	// Components may add other components while updating, so iterate by index
+	for (size_t i = 0; i < m_Components.size(); i++) {
+		auto* component = m_Components[i].second;
+		if (component == nullptr) continue;
 
-		pair.second->Update(deltaTime);
+		component->Update(deltaTime);
 	}
 
 	if (m_ShouldDestroyAfterUpdate) {
@@ -1426,10 +1427,11 @@ void Entity::OnUse(Entity* originator) {
 
 	GetScript()->OnUse(this, originator);
 
-	for (const auto& pair : m_Components) {
-		if (pair.second == nullptr) continue;
+	for (size_t i = 0; i < m_Components.size(); i++) {
+		auto* component = m_Components[i].second;
+		if (component == nullptr) continue;
 
-		pair.second->OnUse(originator);
+		component->OnUse(originator);
 	}
 }
 
@@ -1680,6 +1682,7 @@ void Entity::RegisterCoinDrop(uint64_t count) {
 
 void Entity::AddChild(Entity* child) {
 	m_IsParentChildDirty = true;
+	InvalidateConstruction();
 	m_ChildEntities.push_back(child);
 }
 
@@ -1689,6 +1692,7 @@ void Entity::RemoveChild(Entity* child) {
 	while (entityPosition < m_ChildEntities.size()) {
 		if (!m_ChildEntities[entityPosition] || (m_ChildEntities[entityPosition])->GetObjectID() == child->GetObjectID()) {
 			m_IsParentChildDirty = true;
+			InvalidateConstruction();
 			m_ChildEntities.erase(m_ChildEntities.begin() + entityPosition);
 		} else {
 			entityPosition++;
@@ -1698,6 +1702,7 @@ void Entity::RemoveChild(Entity* child) {
 
 void Entity::RemoveParent() {
 	this->m_ParentEntity = nullptr;
+	InvalidateConstruction();
 }
 
 void Entity::AddTimer(std::string name, float time) {
@@ -1883,7 +1888,10 @@ const NiQuaternion& Entity::GetRotation() const {
 	return NiQuaternionConstant::IDENTITY;
 }
 
-void Entity::SetPosition(const NiPoint3& position) {
+void Entity::SetPhysicsPosition(const NiPoint3& position) {
+	InvalidateConstruction();
+	if (IsPlayer()) Game::entityManager->DropPositionUpdate(GetObjectID());
+
 	auto* controllable = GetComponent<ControllablePhysicsComponent>();
 
 	if (controllable != nullptr) {
@@ -1914,9 +1922,37 @@ void Entity::SetPosition(const NiPoint3& position) {
 		rigidBodyPhantomPhysicsComponent->SetPosition(position);
 	}
 
+}
+
+void Entity::SetPosition(const NiPoint3& position) {
+	SetPhysicsPosition(position);
+
 	Game::entityManager->SerializeEntity(this);
 }
 
+void Entity::SetMovementPosition(const NiPoint3& position) {
+	SetPhysicsPosition(position);
+
+	Game::entityManager->SerializeMovement(this);
+}
+
+void Entity::SetPositionDirty() {
+	auto* controllable = GetComponent<ControllablePhysicsComponent>();
+	if (controllable) controllable->SetDirtyPosition(true);
+
+	auto* phantom = GetComponent<PhantomPhysicsComponent>();
+	if (phantom) phantom->SetDirtyPosition(true);
+
+	auto* simple = GetComponent<SimplePhysicsComponent>();
+	if (simple) simple->SetDirtyPosition(true);
+
+	auto* vehicle = GetComponent<HavokVehiclePhysicsComponent>();
+	if (vehicle) vehicle->SetDirtyPosition(true);
+
+	auto* rigidBodyPhantom = GetComponent<RigidbodyPhantomPhysicsComponent>();
+	if (rigidBodyPhantom) rigidBodyPhantom->SetDirtyPosition(true);
+}
+
 void Entity::SetRotation(const NiQuaternion& rotation) {
 	auto* controllable = GetComponent<ControllablePhysicsComponent>();
 
@@ -2115,12 +2151,7 @@ void Entity::ProcessPositionUpdate(PositionUpdate& update) {
 		update.angularVelocity = NiPoint3Constant::ZERO;
 	}
 
-	// Handle statistics
-	auto* characterComponent = GetComponent<CharacterComponent>();
-	if (characterComponent) {
-		characterComponent->TrackPositionUpdate(update.position);
-	}
-
+	// Statistics are tracked per update by EntityManager::QueuePositionUpdate
 	controllablePhysicsComponent->SetPosition(update.position);
 	controllablePhysicsComponent->SetRotation(update.rotation);
 	controllablePhysicsComponent->SetIsOnGround(update.onGround);
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <array>
 #include <map>
 #include <functional>
+#include <memory>
 #include <typeinfo>
 #include <type_traits>
 #include <unordered_map>
@@ -11,6 +13,8 @@
 #include "NiQuaternion.h"
 #include "LDFFormat.h"
 #include "eKillType.h"
+#include "ComponentSlots.h"
+#include "DluAssert.h"
 
 namespace Loot {
 	class Info;
@@ -34,7 +38,6 @@ class EntityCallbackTimer;
 class PositionUpdate;
 enum class eTriggerEventType;
 enum class eGameMasterLevel : uint8_t;
-enum class eReplicaComponentType : uint32_t;
 enum class eReplicaPacketType : uint8_t;
 enum class eCinematicEvent : uint32_t;
 
@@ -47,6 +50,9 @@ namespace CppScripts {
  */
 class Entity {
 public:
+	// The components of an entity in the order they were added, which is also the order they are updated in
+	using ComponentList = std::vector<std::pair<eReplicaComponentType, Component*>>;
+
 	explicit Entity(const LWOOBJID& objectID, EntityInfo info, User* parentUser = nullptr, Entity* parentEntity = nullptr);
 	~Entity();
 
@@ -124,6 +130,15 @@ public:
 
 	void SetPosition(const NiPoint3& position);
 
+	// Sets the position without queueing a full serialization, so the update can be rate limited per observer by distance.
+	void SetMovementPosition(const NiPoint3& position);
+
+	// Moves every physics component of this entity to the position without serializing it.
+	void SetPhysicsPosition(const NiPoint3& position);
+
+	// Forces the position into the next serialization of this entity, even if it did not change.
+	void SetPositionDirty();
+
 	void SetRotation(const NiQuaternion& rotation);
 
 	void SetRespawnPos(const NiPoint3& position);
@@ -170,10 +185,20 @@ public:
 	void AddToGroup(const std::string& group);
 	bool IsPlayer() const;
 
-	std::unordered_map<eReplicaComponentType, Component*>& GetComponents() { return m_Components; } // TODO: Remove
+	const ComponentList& GetComponents() const { return m_Components; } // TODO: Remove
 
 	void WriteBaseReplicaData(RakNet::BitStream& outBitStream, eReplicaPacketType packetType);
 	void WriteComponents(RakNet::BitStream& outBitStream, eReplicaPacketType packetType);
+
+	// The construction packet of this entity from when it last changed, nullptr if there is none
+	const RakNet::BitStream* GetCachedConstruction() const { return m_CachedConstruction.get(); }
+	void SetCachedConstruction(std::unique_ptr<RakNet::BitStream> construction) { m_CachedConstruction = std::move(construction); }
+
+	// Drops the cached construction packet, called whenever something it contains may have changed
+	void InvalidateConstruction() const;
+
+	// Whether the construction packet only changes together with a serialization, so it may be cached
+	bool CanCacheConstruction() const;
 	void UpdateXMLDoc(tinyxml2::XMLDocument& doc);
 	void Update(float deltaTime);
 
@@ -297,7 +322,7 @@ public:
 	void ProcessPositionUpdate(PositionUpdate& update);
 
 	// Scale will only be communicated to the client when the construction packet is sent
-	void SetScale(const float scale) { m_Scale = scale; };
+	void SetScale(const float scale) { m_Scale = scale; InvalidateConstruction(); };
 
 protected:
 	LWOOBJID m_ObjectID;
@@ -314,6 +339,9 @@ protected:
 	Spawner* m_Spawner;
 	LWOOBJID m_SpawnerID;
 
+	// Reused for every player that constructs this entity until it changes
+	mutable std::unique_ptr<RakNet::BitStream> m_CachedConstruction;
+
 	bool m_HasSpawnerNodeID;
 	uint32_t m_SpawnerNodeID;
 
@@ -328,7 +356,10 @@ protected:
 	std::vector<std::function<void()>> m_DieCallbacks;
 	std::vector<std::function<void(Entity* target)>> m_PhantomCollisionCallbacks;
 
-	std::unordered_map<eReplicaComponentType, Component*> m_Components;
+	ComponentList m_Components;
+
+	// Index into m_Components for every component slot, ComponentSlots::EMPTY if the entity has no such component
+	std::array<uint8_t, ComponentSlots::COUNT> m_ComponentSlots;
 	std::vector<EntityTimer> m_Timers;
 	std::vector<EntityTimer> m_PendingTimers;
 	std::vector<EntityCallbackTimer> m_CallbackTimers;
@@ -358,24 +389,34 @@ protected:
  * Template definitions.
  */
 
-template<typename T>
-bool Entity::TryGetComponent(const eReplicaComponentType componentId, T*& component) const {
-	const auto& index = m_Components.find(componentId);
+inline Component* Entity::GetComponent(const eReplicaComponentType componentID) const {
+	const auto slot = ComponentSlots::GetSlot(componentID);
+	if (slot == ComponentSlots::INVALID) return nullptr;
 
-	if (index == m_Components.end()) {
-		component = nullptr;
+	const auto index = m_ComponentSlots[slot];
+	return index == ComponentSlots::EMPTY ? nullptr : m_Components[index].second;
+}
 
-		return false;
-	}
+inline bool Entity::HasComponent(const eReplicaComponentType componentId) const {
+	return GetComponent(componentId) != nullptr;
+}
+
+template<typename T>
+bool Entity::TryGetComponent(const eReplicaComponentType componentId, T*& component) const {
+	auto* found = GetComponent(componentId);
 
-	component = dynamic_cast<T*>(index->second);
+	// Components are only ever stored in the slot of their own type, so the cast is only checked in debug builds
+	DluAssert(found == nullptr || dynamic_cast<T*>(found) == found);
+	component = static_cast<T*>(found);
 
-	return true;
+	return found != nullptr;
 }
 
 template <typename T>
 T* Entity::GetComponent() const {
-	return dynamic_cast<T*>(GetComponent(T::ComponentType));
+	T* component = nullptr;
+	TryGetComponent(T::ComponentType, component);
+	return component;
 }
 
 
@@ -405,6 +446,8 @@ T Entity::GetVarAs(const std::u16string& name) const {
 
 template<typename T>
 void Entity::SetVar(const std::u16string& name, T value) {
+	InvalidateConstruction();
+
 	auto* data = GetVarData(name);
 
 	if (data == nullptr) {
@@ -426,6 +469,8 @@ void Entity::SetVar(const std::u16string& name, T value) {
 
 template<typename T>
 void Entity::SetNetworkVar(const std::u16string& name, T value, const SystemAddress& sysAddr) {
+	InvalidateConstruction();
+
 	LDFData<T>* newData = nullptr;
 
 	for (auto* data : m_NetworkSettings) {
@@ -455,6 +500,8 @@ void Entity::SetNetworkVar(const std::u16string& name, T value, const SystemAddr
 
 template<typename T>
 void Entity::SetNetworkVar(const std::u16string& name, std::vector<T> values, const SystemAddress& sysAddr) {
+	InvalidateConstruction();
+
 	std::stringstream updates;
 	auto index = 1;
 
@@ -517,13 +564,18 @@ template<typename ComponentType, typename... VaArgs>
 inline ComponentType* Entity::AddComponent(VaArgs... args) {
 	static_assert(std::is_base_of_v<Component, ComponentType>, "ComponentType must be a Component");
 
-	// Get the component if it already exists, or default construct a nullptr
-	auto*& componentToReturn = m_Components[ComponentType::ComponentType];
+	constexpr auto slot = ComponentSlots::GetSlot(ComponentType::ComponentType);
+	static_assert(slot != ComponentSlots::INVALID, "ComponentType must have a component slot");
 
 	// If it doesn't exist, create it and forward the arguments to the constructor
-	if (!componentToReturn) {
-		componentToReturn = new ComponentType(this, std::forward<VaArgs>(args)...);
+	if (m_ComponentSlots[slot] == ComponentSlots::EMPTY) {
+		// The constructor may add other components, so only take an index once it is done
+		auto* component = new ComponentType(this, std::forward<VaArgs>(args)...);
+		m_ComponentSlots[slot] = m_Components.size();
+		m_Components.emplace_back(ComponentType::ComponentType, component);
 	} else {
+		auto* componentToReturn = m_Components[m_ComponentSlots[slot]].second;
+
 		// In this case the block is already allocated and ready for use
 		// so we use a placement new to construct the component again as was requested by the caller.
 		// Placement new means we already have memory allocated for the object, so this just calls its constructor again.
@@ -533,7 +585,6 @@ inline ComponentType* Entity::AddComponent(VaArgs... args) {
 	}
 
 	// Finally return the created or already existing component.
-	// Because of the assert above, this should always be a ComponentType* but I need a way to guarantee the map cannot be modifed outside this function
-	// To allow a static cast here instead of a dynamic one.
-	return dynamic_cast<ComponentType*>(componentToReturn);
+	// Components only ever get into their slot through this function, so the slot always holds a ComponentType.
+	return static_cast<ComponentType*>(m_Components[m_ComponentSlots[slot]].second);
 }
@@ -0,0 +1,102 @@
+#include "EntityArchetype.h"
+
+#include <algorithm>
+#include <climits>
+#include <unordered_map>
+
+#include "CDClientManager.h"
+#include "CDComponentsRegistryTable.h"
+#include "CDCurrencyTableTable.h"
+#include "CDProximityMonitorComponentTable.h"
+#include "GeneralUtils.h"
+#include "eReplicaComponentType.h"
+
+namespace {
+	std::unordered_map<LOT, EntityArchetype> g_Archetypes;
+}
+
+const EntityArchetype& EntityArchetype::Get(const LOT lot) {
+	auto it = g_Archetypes.find(lot);
+	if (it == g_Archetypes.end()) {
+		it = g_Archetypes.emplace(lot, EntityArchetype(lot)).first;
+	}
+
+	return it->second;
+}
+
+EntityArchetype::EntityArchetype(const LOT lot) {
+	auto* compRegistryTable = CDClientManager::GetTable<CDComponentsRegistryTable>();
+
+	// Resolve every component the LOT has once. INT32_MIN marks a component the LOT does not have,
+	// since -1 and 0 are both valid results of the registry.
+	constexpr auto lastComponentType = static_cast<uint32_t>(eReplicaComponentType::CULLING_PLANE);
+	for (uint32_t type = 1; type <= lastComponentType; type++) {
+		const auto componentType = static_cast<eReplicaComponentType>(type);
+		const auto componentId = compRegistryTable->GetByIDAndType(lot, componentType, INT32_MIN);
+		if (componentId != INT32_MIN) m_ComponentIds.emplace_back(componentType, componentId);
+	}
+
+	// Same precedence as the destroyable component setup in Entity::Initialize
+	const auto collectibleComponentID = GetComponentId(eReplicaComponentType::COLLECTIBLE);
+	const auto quickBuildComponentID = GetComponentId(eReplicaComponentType::QUICK_BUILD);
+	const auto buffComponentID = GetComponentId(eReplicaComponentType::BUFF);
+
+	int32_t destructibleComponentID = -1;
+	if (collectibleComponentID > 0) destructibleComponentID = collectibleComponentID;
+	if (quickBuildComponentID > 0) destructibleComponentID = quickBuildComponentID;
+	if (buffComponentID > 0) destructibleComponentID = buffComponentID;
+
+	if (destructibleComponentID > 0) {
+		auto* destCompTable = CDClientManager::GetTable<CDDestructibleComponentTable>();
+		const auto destCompData = destCompTable->Query([=](CDDestructibleComponent entry) { return (entry.id == destructibleComponentID); });
+
+		if (!destCompData.empty()) {
+			m_Destructible = destCompData[0];
+
+			const uint32_t npcMinLevel = m_Destructible->level;
+			const uint32_t currencyIndex = m_Destructible->CurrencyIndex;
+
+			auto* currencyTable = CDClientManager::GetTable<CDCurrencyTableTable>();
+			const auto currencyValues = currencyTable->Query([=](CDCurrencyTable entry) { return (entry.currencyIndex == currencyIndex && entry.npcminlevel == npcMinLevel); });
+
+			if (!currencyValues.empty()) m_Currency = std::make_pair(currencyValues[0].minvalue, currencyValues[0].maxvalue);
+		}
+	}
+
+	if (quickBuildComponentID > 0) {
+		auto* rebCompTable = CDClientManager::GetTable<CDRebuildComponentTable>();
+		const auto rebCompData = rebCompTable->Query([=](CDRebuildComponent entry) { return (entry.id == quickBuildComponentID); });
+
+		if (!rebCompData.empty()) m_QuickBuild = rebCompData[0];
+	}
+
+	const auto movementAIID = GetComponentId(eReplicaComponentType::MOVEMENT_AI);
+	if (movementAIID > 0) {
+		auto* moveAITable = CDClientManager::GetTable<CDMovementAIComponentTable>();
+		const auto moveAIComp = moveAITable->Query([=](CDMovementAIComponent entry) { return (entry.id == movementAIID); });
+
+		if (!moveAIComp.empty()) m_MovementAI = moveAIComp[0];
+	}
+
+	const auto proximityMonitorID = GetComponentId(eReplicaComponentType::PROXIMITY_MONITOR);
+	if (proximityMonitorID > 0) {
+		auto* proxCompTable = CDClientManager::GetTable<CDProximityMonitorComponentTable>();
+		const auto proxCompData = proxCompTable->Query([=](CDProximityMonitorComponent entry) { return (entry.id == proximityMonitorID); });
+
+		if (!proxCompData.empty()) {
+			const auto proximityStr = GeneralUtils::SplitString(proxCompData[0].Proximities, ',');
+			m_Proximities = std::make_pair(std::stoi(proximityStr[0]), std::stoi(proximityStr[1]));
+		}
+	}
+
+	const auto scriptComponentID = GetComponentId(eReplicaComponentType::SCRIPT, -1);
+	if (scriptComponentID > 0) {
+		m_Script = CDClientManager::GetTable<CDScriptComponentTable>()->GetByID(scriptComponentID);
+	}
+}
+
+int32_t EntityArchetype::GetComponentId(const eReplicaComponentType componentType, const int32_t defaultValue) const {
+	const auto it = std::find_if(m_ComponentIds.begin(), m_ComponentIds.end(), [componentType](const auto& entry) { return entry.first == componentType; });
+
+	return it == m_ComponentIds.end() ? defaultValue : it->second;
+}
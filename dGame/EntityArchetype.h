@@ -0,0 +1,70 @@
+#ifndef __ENTITYARCHETYPE__H__
+#define __ENTITYARCHETYPE__H__
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "CDDestructibleComponentTable.h"
+#include "CDMovementAIComponentTable.h"
+#include "CDRebuildComponentTable.h"
+#include "CDScriptComponentTable.h"
+
+enum class eReplicaComponentType : uint32_t;
+
+/**
+ * Everything Entity::Initialize needs to know about a LOT that does not depend on the spawned instance.
+ * Built the first time a LOT is spawned and reused for every following spawn,
+ * so spawning does not have to look up the component registry and scan the component tables every time.
+ */
+class EntityArchetype {
+public:
+	/**
+	 * Returns the archetype of the given LOT, building it if this is the first spawn of the LOT.
+	 */
+	static const EntityArchetype& Get(const LOT lot);
+
+	/**
+	 * Returns the component ID of the given component type for this LOT, or the default value
+	 * if the LOT does not have the component. Same semantics as CDComponentsRegistryTable::GetByIDAndType.
+	 */
+	int32_t GetComponentId(const eReplicaComponentType componentType, const int32_t defaultValue = 0) const;
+
+	// The destructible row used by the destroyable component, if the LOT has one.
+	const std::optional<CDDestructibleComponent>& GetDestructible() const { return m_Destructible; }
+
+	// The minimum and maximum coins dropped, from the currency table row matching the destructible row.
+	const std::optional<std::pair<uint32_t, uint32_t>>& GetCurrency() const { return m_Currency; }
+
+	const std::optional<CDRebuildComponent>& GetQuickBuild() const { return m_QuickBuild; }
+
+	const std::optional<CDMovementAIComponent>& GetMovementAI() const { return m_MovementAI; }
+
+	// The two proximity radii of the proximity monitor component.
+	const std::optional<std::pair<int32_t, int32_t>>& GetProximities() const { return m_Proximities; }
+
+	const std::optional<CDScriptComponent>& GetScript() const { return m_Script; }
+
+private:
+	explicit EntityArchetype(const LOT lot);
+
+	// The component type and component ID of every component in the registry for this LOT.
+	std::vector<std::pair<eReplicaComponentType, int32_t>> m_ComponentIds;
+
+	std::optional<CDDestructibleComponent> m_Destructible;
+
+	std::optional<std::pair<uint32_t, uint32_t>> m_Currency;
+
+	std::optional<CDRebuildComponent> m_QuickBuild;
+
+	std::optional<CDMovementAIComponent> m_MovementAI;
+
+	std::optional<std::pair<int32_t, int32_t>> m_Proximities;
+
+	std::optional<CDScriptComponent> m_Script;
+};
+
+#endif  //!__ENTITYARCHETYPE__H__
@@ -24,8 +24,36 @@
 #include "eReplicaPacketType.h"
 #include "PlayerManager.h"
 #include "GhostComponent.h"
+#include "CharacterComponent.h"
+#include <chrono>
+#include <limits>
 #include <ranges>
 
+namespace {
+	// Seconds an observer keeps its movement state after its last movement update
+	constexpr double movementStateTimeout = 5.0;
+
+	// NPCs and objects players interact with, these are constructed first for a player loading in
+	constexpr eReplicaComponentType interactableComponents[] = {
+		eReplicaComponentType::MISSION_OFFER,
+		eReplicaComponentType::VENDOR,
+		eReplicaComponentType::DONATION_VENDOR,
+		eReplicaComponentType::ACHIEVEMENT_VENDOR,
+		eReplicaComponentType::PROPERTY_VENDOR,
+		eReplicaComponentType::QUICK_BUILD,
+		eReplicaComponentType::SWITCH,
+		eReplicaComponentType::ROCKET_LAUNCH,
+		eReplicaComponentType::RAIL_ACTIVATOR,
+		eReplicaComponentType::PROPERTY_ENTRANCE,
+		eReplicaComponentType::SCRIPTED_ACTIVITY,
+		eReplicaComponentType::INTERACTION_MANAGER,
+	};
+
+	bool IsInteractable(const Entity& entity) {
+		return entity.IsPlayer() || std::ranges::any_of(interactableComponents, [&entity](const auto type) { return entity.HasComponent(type); });
+	}
+}
+
 // Configure which zones have ghosting disabled, mostly small worlds.
 std::vector<LWOMAPID> EntityManager::m_GhostingExcludedZones = {
 	// Small zones
@@ -73,6 +101,15 @@ void EntityManager::Initialize() {
 	// If cloneID is not zero, then hardcore mode is disabled
 	// aka minigames and props
 	if (Game::zoneManager->GetZoneID().GetCloneID() != 0) m_HardcoreMode = false;
+
+	const auto nearDistance = GeneralUtils::TryParse<float>(Game::config->GetValue("movement_update_near_distance")).value_or(40.0f);
+	const auto midDistance = GeneralUtils::TryParse<float>(Game::config->GetValue("movement_update_mid_distance")).value_or(80.0f);
+	m_MovementNearDistanceSquared = nearDistance * nearDistance;
+	m_MovementMidDistanceSquared = midDistance * midDistance;
+	m_MovementMidInterval = GeneralUtils::TryParse<float>(Game::config->GetValue("movement_update_mid_interval")).value_or(0.25f);
+
+	m_ConstructionBudgetBytes = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("construction_budget_bytes")).value_or(64 * 1024);
+	m_ConstructionBudgetTime = GeneralUtils::TryParse<float>(Game::config->GetValue("construction_budget_ms")).value_or(2.0f) / 1000.0f;
 }
 
 Entity* EntityManager::CreateEntity(EntityInfo info, User* user, Entity* parentEntity, const bool controller, const LWOOBJID explicitId) {
@@ -166,33 +203,127 @@ void EntityManager::DestroyEntity(Entity* entity) {
 }
 
 void EntityManager::SerializeEntities() {
+	std::unordered_set<LWOOBJID> serialized;
+
 	for (size_t i = 0; i < m_EntitiesToSerialize.size(); i++) {
 		const LWOOBJID toSerialize = m_EntitiesToSerialize[i];
 		auto* entity = GetEntity(toSerialize);
 
 		if (!entity) continue;
 
-		m_SerializationCounter++;
+		// Observers that skipped movement updates get the latest position with the state change
+		const auto movementStates = m_MovementStates.find(toSerialize);
+		if (movementStates != m_MovementStates.end()) {
+			if (std::ranges::any_of(movementStates->second | std::views::values, &MovementState::pending)) entity->SetPositionDirty();
+			m_MovementStates.erase(movementStates);
+		}
 
 		RakNet::BitStream stream;
-		stream.Write<char>(ID_REPLICA_MANAGER_SERIALIZE);
-		stream.Write<unsigned short>(entity->GetNetworkId());
+		WriteSerialization(*entity, stream);
 
-		entity->WriteBaseReplicaData(stream, eReplicaPacketType::SERIALIZATION);
-		entity->WriteComponents(stream, eReplicaPacketType::SERIALIZATION);
+		SendToObservers(stream, toSerialize);
+		serialized.insert(toSerialize);
+	}
+	m_EntitiesToSerialize.clear();
 
-		if (entity->GetIsGhostingCandidate()) {
-			for (auto* player : PlayerManager::GetAllPlayers()) {
-				auto* ghostComponent = player->GetComponent<GhostComponent>();
-				if (ghostComponent && ghostComponent->IsObserved(toSerialize)) {
-					Game::server->Send(stream, player->GetSystemAddress(), false);
-				}
-			}
-		} else {
+	SendMovementUpdates(serialized);
+	SendPendingMovement();
+}
+
+void EntityManager::SendMovementUpdates(const std::unordered_set<LWOOBJID>& serialized) {
+	for (const auto toSerialize : m_MovementToSerialize) {
+		// The state serialization already carried the new position
+		if (serialized.contains(toSerialize)) continue;
+
+		auto* entity = GetEntity(toSerialize);
+		if (!entity) continue;
+
+		RakNet::BitStream stream;
+		WriteSerialization(*entity, stream);
+
+		if (!entity->GetIsGhostingCandidate()) {
 			Game::server->Send(stream, UNASSIGNED_SYSTEM_ADDRESS, true);
+			continue;
+		}
+
+		auto& states = m_MovementStates[toSerialize];
+		for (auto* player : PlayerManager::GetAllPlayers()) {
+			auto* ghostComponent = player->GetComponent<GhostComponent>();
+			if (!ghostComponent || !ghostComponent->IsObserved(toSerialize)) continue;
+
+			auto& state = states[player->GetObjectID()];
+			const auto interval = GetMovementInterval(ghostComponent->GetGhostReferencePoint(), entity->GetPosition());
+			if (m_Time - state.lastSent >= interval) {
+				Game::server->QueueSend(stream, player->GetSystemAddress());
+				state.lastSent = m_Time;
+				state.pending = false;
+			} else {
+				state.pending = true;
+			}
 		}
 	}
-	m_EntitiesToSerialize.clear();
+	m_MovementToSerialize.clear();
+}
+
+void EntityManager::SendPendingMovement() {
+	std::vector<SystemAddress> due;
+
+	for (auto it = m_MovementStates.begin(); it != m_MovementStates.end();) {
+		const auto id = it->first;
+		auto& states = it->second;
+		auto* entity = GetEntity(id);
+
+		due.clear();
+		for (auto stateIt = states.begin(); stateIt != states.end();) {
+			auto& [playerID, state] = *stateIt;
+			auto* player = PlayerManager::GetPlayer(playerID);
+			auto* ghostComponent = player ? player->GetComponent<GhostComponent>() : nullptr;
+
+			const auto observed = entity && ghostComponent && ghostComponent->IsObserved(id);
+			if (!observed || (!state.pending && m_Time - state.lastSent >= movementStateTimeout)) {
+				stateIt = states.erase(stateIt);
+				continue;
+			}
+
+			if (state.pending && m_Time - state.lastSent >= GetMovementInterval(ghostComponent->GetGhostReferencePoint(), entity->GetPosition())) {
+				due.push_back(player->GetSystemAddress());
+				state.lastSent = m_Time;
+				state.pending = false;
+			}
+
+			++stateIt;
+		}
+
+		// The entity stopped moving before these observers were due, so send them its current position
+		if (!due.empty()) {
+			entity->SetPositionDirty();
+
+			RakNet::BitStream stream;
+			WriteSerialization(*entity, stream);
+
+			for (const auto& sysAddr : due) Game::server->QueueSend(stream, sysAddr);
+		}
+
+		if (states.empty()) it = m_MovementStates.erase(it);
+		else ++it;
+	}
+}
+
+void EntityManager::WriteSerialization(Entity& entity, RakNet::BitStream& stream) {
+	m_SerializationCounter++;
+
+	stream.Write<char>(ID_REPLICA_MANAGER_SERIALIZE);
+	stream.Write<unsigned short>(entity.GetNetworkId());
+
+	entity.WriteBaseReplicaData(stream, eReplicaPacketType::SERIALIZATION);
+	entity.WriteComponents(stream, eReplicaPacketType::SERIALIZATION);
+}
+
+float EntityManager::GetMovementInterval(const NiPoint3& referencePoint, const NiPoint3& position) const {
+	const auto distance = NiPoint3::DistanceSquared(referencePoint, position);
+	if (distance <= m_MovementNearDistanceSquared) return 0.0f;
+	if (distance <= m_MovementMidDistanceSquared) return m_MovementMidInterval;
+	return std::numeric_limits<float>::infinity();
 }
 
 void EntityManager::KillEntities() {
@@ -239,6 +370,8 @@ void EntityManager::DeleteEntities() {
 }
 
 void EntityManager::UpdateEntities(const float deltaTime) {
+	m_Time += deltaTime;
+
 	for (auto* entity : m_Entities | std::views::values) {
 		entity->Update(deltaTime);
 	}
@@ -295,12 +428,17 @@ std::vector<Entity*> EntityManager::GetEntitiesByLOT(const LOT& lot) const {
 
 std::vector<Entity*> EntityManager::GetEntitiesByProximity(NiPoint3 reference, float radius) const {
 	std::vector<Entity*> entities;
+	GetEntitiesByProximity(reference, radius, entities);
+	return entities;
+}
+
+void EntityManager::GetEntitiesByProximity(NiPoint3 reference, float radius, std::vector<Entity*>& entities) const {
+	entities.clear();
 	if (radius <= 1000.0f) { // The client has a 1000 unit limit on this same logic, so we'll use the same limit
 		for (auto* entity : m_Entities | std::views::values) {
 			if (NiPoint3::Distance(reference, entity->GetPosition()) <= radius) entities.push_back(entity);
 		}
 	}
-	return entities;
 }
 
 
@@ -320,10 +458,10 @@ const std::unordered_map<std::string, LWOOBJID>& EntityManager::GetSpawnPointEnt
 	return m_SpawnPoints;
 }
 
-void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr, const bool skipChecks) {
+uint32_t EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr, const bool skipChecks) {
 	if (!entity) {
 		LOG("Attempted to construct null entity");
-		return;
+		return 0;
 	}
 
 	if (entity->GetNetworkId() == 0) {
@@ -347,28 +485,40 @@ void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr
 		if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) {
 			CheckGhosting(entity);
 
-			return;
+			return 0;
 		}
 	}
 
-	m_SerializationCounter++;
-
 	RakNet::BitStream stream;
 
-	stream.Write<uint8_t>(ID_REPLICA_MANAGER_CONSTRUCTION);
-	stream.Write(true);
-	stream.Write<uint16_t>(entity->GetNetworkId());
+	const auto* cached = entity->GetCachedConstruction();
+	if (cached) {
+		stream.WriteBits(cached->GetData(), cached->GetNumberOfBitsUsed(), false);
+	} else {
+		m_SerializationCounter++;
 
-	entity->WriteBaseReplicaData(stream, eReplicaPacketType::CONSTRUCTION);
-	entity->WriteComponents(stream, eReplicaPacketType::CONSTRUCTION);
+		stream.Write<uint8_t>(ID_REPLICA_MANAGER_CONSTRUCTION);
+		stream.Write(true);
+		stream.Write<uint16_t>(entity->GetNetworkId());
 
+		entity->WriteBaseReplicaData(stream, eReplicaPacketType::CONSTRUCTION);
+		entity->WriteComponents(stream, eReplicaPacketType::CONSTRUCTION);
+
+		if (entity->CanCacheConstruction()) {
+			auto construction = std::make_unique<RakNet::BitStream>();
+			construction->WriteBits(stream.GetData(), stream.GetNumberOfBitsUsed(), false);
+			entity->SetCachedConstruction(std::move(construction));
+		}
+	}
+
+	// Constructions for a single player are queued, so a player loading in gets many of them per datagram
 	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) {
 		if (skipChecks) {
 			Game::server->Send(stream, UNASSIGNED_SYSTEM_ADDRESS, true);
 		} else {
 			for (auto* player : PlayerManager::GetAllPlayers()) {
 				if (player->GetPlayerReadyForUpdates()) {
-					Game::server->Send(stream, player->GetSystemAddress(), false);
+					Game::server->QueueSend(stream, player->GetSystemAddress());
 				} else {
 					auto* ghostComponent = player->GetComponent<GhostComponent>();
 					if (ghostComponent) ghostComponent->AddLimboConstruction(entity->GetObjectID());
@@ -376,7 +526,7 @@ void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr
 			}
 		}
 	} else {
-		Game::server->Send(stream, sysAddr, false);
+		Game::server->QueueSend(stream, sysAddr);
 	}
 
 	if (entity->IsPlayer()) {
@@ -384,19 +534,110 @@ void EntityManager::ConstructEntity(Entity* entity, const SystemAddress& sysAddr
 			GameMessages::SendToggleGMInvis(entity->GetObjectID(), true, sysAddr);
 		}
 	}
+
+	return stream.GetNumberOfBytesUsed();
 }
 
 void EntityManager::ConstructAllEntities(const SystemAddress& sysAddr) {
 	//ZoneControl is special:
 	ConstructEntity(m_ZoneControlEntity, sysAddr);
 
+	auto* player = PlayerManager::GetPlayer(sysAddr);
+	if (!player) return;
+
+	const auto& referencePoint = player->GetPosition();
+
+	std::vector<ConstructionCandidate> candidates;
 	for (auto* entity : m_Entities | std::views::values) {
 		if (entity && (entity->GetSpawnerID() != 0 || entity->GetLOT() == 1) && !entity->GetIsGhostingCandidate()) {
-			ConstructEntity(entity, sysAddr);
+			const auto distance = NiPoint3::DistanceSquared(referencePoint, entity->GetPosition());
+			const auto important = distance < m_GhostDistanceMinSqaured && IsInteractable(*entity);
+			candidates.push_back({ entity->GetObjectID(), important, distance });
 		}
 	}
 
-	UpdateGhosting(PlayerManager::GetPlayer(sysAddr));
+	// Queued even if empty, the player is told it is done loading once the queue is sent
+	m_ConstructionQueues[player->GetObjectID()] = OrderConstructions(std::move(candidates));
+}
+
+std::vector<LWOOBJID> EntityManager::OrderConstructions(std::vector<ConstructionCandidate> candidates) {
+	// The next one to construct goes at the back
+	std::ranges::sort(candidates, [](const ConstructionCandidate& a, const ConstructionCandidate& b) {
+		if (a.important != b.important) return b.important;
+		return a.distanceSquared > b.distanceSquared;
+	});
+
+	std::vector<LWOOBJID> queue;
+	queue.reserve(candidates.size());
+	for (const auto& candidate : candidates) queue.push_back(candidate.id);
+	return queue;
+}
+
+void EntityManager::SendQueuedConstructions() {
+	if (m_ConstructionQueues.empty()) return;
+
+	// Players that left while loading in don't need the rest of their queue
+	std::erase_if(m_ConstructionQueues, [](const auto& queue) { return PlayerManager::GetPlayer(queue.first) == nullptr; });
+
+	const auto construct = [this](const LWOOBJID playerID, const LWOOBJID id) -> std::optional<uint32_t> {
+		// Skip entities that were destroyed while they were queued
+		auto* entity = GetEntity(id);
+		if (!entity || std::ranges::find(m_EntitiesToDelete, id) != m_EntitiesToDelete.end()) return std::nullopt;
+
+		return ConstructEntity(entity, PlayerManager::GetPlayer(playerID)->GetSystemAddress());
+	};
+
+	const auto drained = [this](const LWOOBJID playerID) {
+		auto* player = PlayerManager::GetPlayer(playerID);
+
+		// Ghosted entities follow once everything that is always visible was constructed. Only then the client may
+		// report it is loaded, which runs the zone and script load hooks that expect their objects to exist.
+		UpdateGhosting(player);
+		GameMessages::SendServerDoneLoadingAllObjects(player, player->GetSystemAddress());
+	};
+
+	SendConstructions(m_ConstructionQueues, m_ConstructionBudgetBytes, m_ConstructionBudgetTime, construct, drained);
+}
+
+void EntityManager::SendConstructions(ConstructionQueues& queues, const uint32_t budgetBytes, const float budgetTime,
+	const std::function<std::optional<uint32_t>(LWOOBJID player, LWOOBJID entity)>& construct,
+	const std::function<void(LWOOBJID player)>& drained) {
+	const auto start = std::chrono::steady_clock::now();
+	uint32_t bytesSent = 0;
+
+	// Every player loading in gets one construction per round, so they share the budget of the frame
+	while (!queues.empty()) {
+		for (auto it = queues.begin(); it != queues.end();) {
+			auto& queue = it->second;
+			while (!queue.empty()) {
+				const auto id = queue.back();
+				queue.pop_back();
+
+				const auto bytes = construct(it->first, id);
+				if (!bytes) continue;
+
+				bytesSent += *bytes;
+				break;
+			}
+
+			if (queue.empty()) {
+				const auto player = it->first;
+				it = queues.erase(it);
+				drained(player);
+			} else {
+				++it;
+			}
+
+			const auto elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+			if (bytesSent >= budgetBytes || elapsed >= budgetTime) return;
+		}
+	}
+}
+
+uint32_t EntityManager::GetQueuedConstructions() const {
+	uint32_t queued = 0;
+	for (const auto& queue : m_ConstructionQueues | std::views::values) queued += queue.size();
+	return queued;
 }
 
 void EntityManager::DestructEntity(Entity* entity, const SystemAddress& sysAddr) {
@@ -426,12 +667,42 @@ void EntityManager::SerializeEntity(Entity* entity) {
 void EntityManager::SerializeEntity(const Entity& entity) {
 	if (entity.GetNetworkId() == 0) return;
 
+	entity.InvalidateConstruction();
+
 	if (std::find(m_EntitiesToSerialize.cbegin(), m_EntitiesToSerialize.cend(), entity.GetObjectID()) == m_EntitiesToSerialize.cend()) {
 		m_EntitiesToSerialize.push_back(entity.GetObjectID());
 	}
 }
 
+void EntityManager::SerializeMovement(Entity* entity) {
+	if (!entity || entity->GetNetworkId() == 0) return;
+
+	entity->InvalidateConstruction();
+
+	if (std::find(m_MovementToSerialize.cbegin(), m_MovementToSerialize.cend(), entity->GetObjectID()) == m_MovementToSerialize.cend()) {
+		m_MovementToSerialize.push_back(entity->GetObjectID());
+	}
+}
+
+void EntityManager::SendToObservers(RakNet::BitStream& bitStream, const LWOOBJID source) {
+	const auto* entity = GetEntity(source);
+	if (!entity || !entity->GetIsGhostingCandidate()) {
+		Game::server->Send(bitStream, UNASSIGNED_SYSTEM_ADDRESS, true);
+		return;
+	}
+
+	for (auto* player : PlayerManager::GetAllPlayers()) {
+		auto* ghostComponent = player->GetComponent<GhostComponent>();
+		if (ghostComponent && ghostComponent->IsObserved(source)) {
+			Game::server->QueueSend(bitStream, player->GetSystemAddress());
+		}
+	}
+}
+
 void EntityManager::DestructAllEntities(const SystemAddress& sysAddr) {
+	auto* player = PlayerManager::GetPlayer(sysAddr);
+	if (player) m_ConstructionQueues.erase(player->GetObjectID());
+
 	for (auto* entity : m_Entities | std::views::values) {
 		DestructEntity(entity, sysAddr);
 	}
@@ -451,6 +722,33 @@ void EntityManager::QueueGhostUpdate(LWOOBJID playerID) {
 	}
 }
 
+void EntityManager::QueuePositionUpdate(Entity* player, const PositionUpdate& update) {
+	if (!player) return;
+
+	const auto [pending, inserted] = m_PendingPositionUpdates.try_emplace(player->GetObjectID(), update);
+	const auto& previousPosition = inserted ? player->GetPosition() : pending->second.position;
+
+	auto* characterComponent = player->GetComponent<CharacterComponent>();
+	if (characterComponent) characterComponent->TrackPositionUpdate(previousPosition, update.position);
+
+	if (!inserted) pending->second = update;
+}
+
+void EntityManager::ApplyPositionUpdates() {
+	// Swapped out first, applying an update may drop other pending updates
+	auto updates = std::move(m_PendingPositionUpdates);
+	m_PendingPositionUpdates.clear();
+
+	for (auto& [playerID, update] : updates) {
+		auto* player = GetEntity(playerID);
+		if (player) player->ProcessPositionUpdate(update);
+	}
+}
+
+void EntityManager::DropPositionUpdate(LWOOBJID playerID) {
+	m_PendingPositionUpdates.erase(playerID);
+}
+
 void EntityManager::UpdateGhosting() {
 	for (const auto playerID : m_PlayersToUpdateGhosting) {
 		auto* player = PlayerManager::GetPlayer(playerID);
@@ -1,12 +1,16 @@
 #ifndef ENTITYMANAGER_H
 #define ENTITYMANAGER_H
 
+#include <functional>
 #include <map>
+#include <optional>
 #include <stack>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "dCommonVars.h"
+#include "PositionUpdate.h"
 
 class Entity;
 class EntityInfo;
@@ -29,6 +33,8 @@ public:
 	std::vector<Entity*> GetEntitiesByComponent(eReplicaComponentType componentType) const;
 	std::vector<Entity*> GetEntitiesByLOT(const LOT& lot) const;
 	std::vector<Entity*> GetEntitiesByProximity(NiPoint3 reference, float radius) const;
+	// Fills entities with the entities in range, so callers can reuse the vector
+	void GetEntitiesByProximity(NiPoint3 reference, float radius, std::vector<Entity*>& entities) const;
 	Entity* GetZoneControlEntity() const;
 
 	// Get spawn point entity by spawn name
@@ -42,17 +48,65 @@ public:
 	const std::unordered_map<LWOOBJID, Entity*> GetAllEntities() const { return m_Entities; }
 #endif
 
-	void ConstructEntity(Entity* entity, const SystemAddress& sysAddr = UNASSIGNED_SYSTEM_ADDRESS, bool skipChecks = false);
+	// Returns the size of the construction in bytes, 0 if it was not sent
+	uint32_t ConstructEntity(Entity* entity, const SystemAddress& sysAddr = UNASSIGNED_SYSTEM_ADDRESS, bool skipChecks = false);
 	void DestructEntity(Entity* entity, const SystemAddress& sysAddr = UNASSIGNED_SYSTEM_ADDRESS);
 	void SerializeEntity(Entity* entity);
 	void SerializeEntity(const Entity& entity);
 
+	// Queues an entity of which only the position changed. Observers further away get these updates
+	// less often, but always get the latest position once their interval passed or the entity changes state.
+	void SerializeMovement(Entity* entity);
+
+	// Sends a packet about an entity to only the players that have it constructed.
+	// Entities that are not ghosted are constructed for everyone, so those are broadcast.
+	void SendToObservers(RakNet::BitStream& bitStream, const LWOOBJID source);
+
+	// Constructs the zone control entity for a player loading in and queues every other entity that is not ghosted,
+	// interactables near the player first. Once the queue is sent ghosting is updated for the player
+	// and the client is told it is done loading, so it does not start the zone without its objects.
 	void ConstructAllEntities(const SystemAddress& sysAddr);
+
+	// Sends queued constructions until the byte or time budget of the frame is used up
+	void SendQueuedConstructions();
+
+	struct ConstructionCandidate {
+		LWOOBJID id;
+		// Interactables near the player go before everything else
+		bool important;
+		float distanceSquared;
+	};
+
+	// Entities left to construct by player, the next one is at the back
+	using ConstructionQueues = std::unordered_map<LWOOBJID, std::vector<LWOOBJID>>;
+
+	// Orders the entities to construct for a player loading in, important ones first and then by distance
+	static std::vector<LWOOBJID> OrderConstructions(std::vector<ConstructionCandidate> candidates);
+
+	// Takes the next construction of every queue in turn until the byte or time budget is used up.
+	// construct returns the bytes it sent, or nothing for an entity that is gone so the next one is taken instead.
+	// drained is called for every player whose queue was sent completely, after which the queue is removed.
+	static void SendConstructions(ConstructionQueues& queues, const uint32_t budgetBytes, const float budgetTime,
+		const std::function<std::optional<uint32_t>(LWOOBJID player, LWOOBJID entity)>& construct,
+		const std::function<void(LWOOBJID player)>& drained);
+
+	// The number of constructions still queued for players loading in
+	uint32_t GetQueuedConstructions() const;
 	void DestructAllEntities(const SystemAddress& sysAddr);
 
 	void SetGhostDistanceMax(float value);
 	void SetGhostDistanceMin(float value);
 	void QueueGhostUpdate(LWOOBJID playerID);
+
+	// Keeps only the latest position update of a player until ApplyPositionUpdates,
+	// while still tracking the distance between every update for the player's statistics.
+	void QueuePositionUpdate(Entity* player, const PositionUpdate& update);
+
+	// Applies the latest queued position update of every player.
+	void ApplyPositionUpdates();
+
+	// Drops the queued position update of a player, so it can't undo a position the server set afterwards.
+	void DropPositionUpdate(LWOOBJID playerID);
 	void UpdateGhosting();
 	void UpdateGhosting(Entity* player);
 	void CheckGhosting(Entity* entity);
@@ -73,7 +127,21 @@ public:
 	const uint32_t GetHardcoreUscoreEnemiesMultiplier() { return m_HardcoreUscoreEnemiesMultiplier; };
 
 private:
+	struct MovementState {
+		// Time of the last movement update sent to the observer
+		double lastSent = 0.0;
+		// Whether the observer skipped a movement update since then
+		bool pending = false;
+	};
+
 	void SerializeEntities();
+	void SendMovementUpdates(const std::unordered_set<LWOOBJID>& serialized);
+	void SendPendingMovement();
+	void WriteSerialization(Entity& entity, RakNet::BitStream& stream);
+
+	// Seconds between movement updates for an observer at the reference point, infinity for only on state changes
+	float GetMovementInterval(const NiPoint3& referencePoint, const NiPoint3& position) const;
+
 	void KillEntities();
 	void DeleteEntities();
 
@@ -84,8 +152,14 @@ private:
 	std::vector<LWOOBJID> m_EntitiesToKill;
 	std::vector<LWOOBJID> m_EntitiesToDelete;
 	std::vector<LWOOBJID> m_EntitiesToSerialize;
+	std::vector<LWOOBJID> m_MovementToSerialize;
+	// The movement state of every player observing an entity, by entity
+	std::unordered_map<LWOOBJID, std::unordered_map<LWOOBJID, MovementState>> m_MovementStates;
 	std::vector<Entity*> m_EntitiesToGhost;
 	std::vector<LWOOBJID> m_PlayersToUpdateGhosting;
+	std::unordered_map<LWOOBJID, PositionUpdate> m_PendingPositionUpdates;
+	// Entities left to construct for every player loading in
+	ConstructionQueues m_ConstructionQueues;
 	Entity* m_ZoneControlEntity;
 
 	uint16_t m_NetworkIdCounter;
@@ -95,6 +169,16 @@ private:
 	float m_GhostDistanceMaxSquared = 150 * 150;
 	bool m_GhostingEnabled = true;
 
+	// Seconds the entities have been updated for
+	double m_Time = 0.0;
+	float m_MovementNearDistanceSquared = 40 * 40;
+	float m_MovementMidDistanceSquared = 80 * 80;
+	float m_MovementMidInterval = 0.25f;
+
+	// Budget per frame for sending queued constructions, in bytes and seconds
+	uint32_t m_ConstructionBudgetBytes = 64 * 1024;
+	float m_ConstructionBudgetTime = 0.002f;
+
 	std::stack<uint16_t> m_LostNetworkIds;
 
 	// Map of spawnname to entity object ID
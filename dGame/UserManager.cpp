@@ -16,6 +16,7 @@
 #include "GeneralUtils.h"
 #include "ZoneInstanceManager.h"
 #include "dServer.h"
+#include "eServerDisconnectIdentifiers.h"
 #include "Entity.h"
 #include "EntityManager.h"
 #include "SkillComponent.h"
@@ -210,8 +211,7 @@ void UserManager::RequestCharacterList(const SystemAddress& sysAddr) {
 
 	for (const auto& characterId : Database::Get()->GetAccountCharacterIds(u->GetAccountID())) {
 		Character* character = new Character(characterId, u);
-		character->UpdateFromDatabase();
-		character->SetIsNewLogin();
+		character->UpdateSummaryFromDatabase();
 		chars.push_back(character);
 	}
 
@@ -515,6 +515,15 @@ void UserManager::LoginCharacter(const SystemAddress& sysAddr, uint32_t playerID
 	if (hasCharacter && character) {
 		Database::Get()->UpdateLastLoggedInCharacter(playerID);
 
+		// The character list only loads summaries, so the xml is only read for the character actually being played.
+		character->UpdateFromDatabase();
+		if (character->GetXmlLoadFailed()) {
+			Game::server->Disconnect(sysAddr, eServerDisconnectIdentifiers::CHARACTER_CORRUPTED);
+			return;
+		}
+
+		character->SetIsNewLogin();
+
 		uint32_t zoneID = character->GetZoneID();
 		if (zoneID == LWOZONEID_INVALID) zoneID = 1000; //Send char to VE
 
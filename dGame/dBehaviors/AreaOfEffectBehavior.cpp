@@ -68,8 +68,9 @@ void AreaOfEffectBehavior::Calculate(BehaviorContext* context, RakNet::BitStream
 
 	reference += this->m_offset;
 
-	std::vector<Entity*> targets {};
-	targets = Game::entityManager->GetEntitiesByProximity(reference, this->m_radius);
+	ScopedTargetList scopedTargets{ context };
+	auto& targets = scopedTargets.targets;
+	Game::entityManager->GetEntitiesByProximity(reference, this->m_radius, targets);
 	context->FilterTargets(targets, this->m_ignoreFactionList, this->m_includeFactionList, this->m_targetSelf, this->m_targetEnemy, this->m_targetFriend, this->m_targetTeam);
 
 	// sort by distance
@@ -8,6 +8,7 @@
 #include "dServer.h"
 #include "BitStreamUtils.h"
 
+#include <memory>
 #include <sstream>
 
 #include "DestroyableComponent.h"
@@ -18,6 +19,13 @@
 #include "TeamManager.h"
 #include "eConnectionType.h"
 
+namespace {
+	// Contexts kept for reuse, more than this are freed when released
+	constexpr size_t maxPooledContexts = 256;
+
+	std::vector<std::unique_ptr<BehaviorContext>> pooledContexts;
+}
+
 BehaviorSyncEntry::BehaviorSyncEntry() {
 }
 
@@ -457,10 +465,29 @@ bool BehaviorContext::CheckFactionList(std::forward_list<int32_t>& factionList,
 }
 
 
-BehaviorContext::BehaviorContext(const LWOOBJID originator, const bool calculation) {
+std::vector<Entity*>& BehaviorContext::BorrowTargetList() {
+	if (this->targetListsInUse == this->targetLists.size()) this->targetLists.emplace_back();
+
+	auto& targets = this->targetLists[this->targetListsInUse++];
+	targets.clear();
+
+	return targets;
+}
+
+void BehaviorContext::ReturnTargetList() {
+	if (this->targetListsInUse > 0) this->targetListsInUse--;
+}
+
+void BehaviorContext::Initialize(const LWOOBJID originator, const bool calculation) {
 	this->originator = originator;
-	this->syncEntries = {};
-	this->timerEntries = {};
+	this->foundTarget = false;
+	this->skillTime = 0;
+	this->skillID = 0;
+	this->failed = false;
+	this->clientInitalized = false;
+	this->unmanaged = false;
+	this->caster = LWOOBJID_EMPTY;
+	this->targetListsInUse = 0;
 
 	if (calculation) {
 		this->skillUId = GetUniqueSkillId();
@@ -469,6 +496,35 @@ BehaviorContext::BehaviorContext(const LWOOBJID originator, const bool calculati
 	}
 }
 
+BehaviorContext::BehaviorContext(const LWOOBJID originator, const bool calculation) {
+	Initialize(originator, calculation);
+}
+
 BehaviorContext::~BehaviorContext() {
 	Reset();
 }
+
+BehaviorContext* BehaviorContextPool::Acquire(const LWOOBJID originator, const bool calculation) {
+	if (pooledContexts.empty()) return new BehaviorContext(originator, calculation);
+
+	auto* context = pooledContexts.back().release();
+	pooledContexts.pop_back();
+
+	context->Initialize(originator, calculation);
+
+	return context;
+}
+
+void BehaviorContextPool::Release(BehaviorContext* context) {
+	if (!context) return;
+
+	context->Reset();
+
+	if (pooledContexts.size() >= maxPooledContexts) {
+		delete context;
+
+		return;
+	}
+
+	pooledContexts.emplace_back(context);
+}
@@ -5,6 +5,7 @@
 #include "BehaviorBranchContext.h"
 #include "GameMessages.h"
 
+#include <deque>
 #include <vector>
 #include <forward_list>
 
@@ -79,6 +80,11 @@ struct BehaviorContext
 
 	LWOOBJID caster = LWOOBJID_EMPTY;
 
+	// Target lists lent out by BorrowTargetList, a deque so lent lists never move when more are added
+	std::deque<std::vector<Entity*>> targetLists;
+
+	size_t targetListsInUse = 0;
+
 	uint32_t GetUniqueSkillId() const;
 
 	void UpdatePlayerSyncs(float deltaTime);
@@ -113,7 +119,46 @@ struct BehaviorContext
 
 	bool CheckFactionList(std::forward_list<int32_t>& factionList, std::vector<int32_t>& objectsFactions) const;
 
+	/**
+	 * Lends an empty target list until the matching ReturnTargetList. Lists keep their capacity
+	 * while the context is pooled, so most calculations do not allocate them.
+	 */
+	std::vector<Entity*>& BorrowTargetList();
+
+	void ReturnTargetList();
+
+	// Sets up a new or recycled context for a cast
+	void Initialize(LWOOBJID originator, bool calculation = false);
+
 	explicit BehaviorContext(LWOOBJID originator, bool calculation = false);
 
 	~BehaviorContext();
 };
+
+/**
+ * Borrows a target list of a context for as long as it is in scope.
+ */
+struct ScopedTargetList {
+	explicit ScopedTargetList(BehaviorContext* context) : context{ context }, targets{ context->BorrowTargetList() } {}
+
+	~ScopedTargetList() { context->ReturnTargetList(); }
+
+	ScopedTargetList(const ScopedTargetList&) = delete;
+	ScopedTargetList& operator=(const ScopedTargetList&) = delete;
+
+	BehaviorContext* context;
+
+	std::vector<Entity*>& targets;
+};
+
+/**
+ * Recycles behavior contexts of this zone, so casts and damage over time ticks reuse
+ * the entry vectors of earlier casts instead of allocating new ones.
+ */
+namespace BehaviorContextPool {
+	// Returns a context set up like a newly constructed one
+	BehaviorContext* Acquire(LWOOBJID originator, bool calculation = false);
+
+	// Resets the context, running its pending timer and end behaviors, and takes it back into the pool
+	void Release(BehaviorContext* context);
+};
@@ -19,7 +19,7 @@ void HealBehavior::Handle(BehaviorContext* context, RakNet::BitStream& bit_strea
 	auto* destroyable = static_cast<DestroyableComponent*>(entity->GetComponent(eReplicaComponentType::DESTROYABLE));
 
 	if (destroyable == nullptr) {
-		LOG("Failed to find destroyable component for %(llu)!", branch.target);
+		LOG("Failed to find destroyable component for %llu!", branch.target);
 
 		return;
 	}
@@ -12,7 +12,8 @@
 #include <vector>
 
 void TacArcBehavior::Handle(BehaviorContext* context, RakNet::BitStream& bitStream, BehaviorBranchContext branch) {
-	std::vector<Entity*> targets = {};
+	ScopedTargetList scopedTargets{ context };
+	auto& targets = scopedTargets.targets;
 
 	if (this->m_usePickedTarget && branch.target != LWOOBJID_EMPTY) {
 		auto target = Game::entityManager->GetEntity(branch.target);
@@ -89,7 +90,8 @@ void TacArcBehavior::Calculate(BehaviorContext* context, RakNet::BitStream& bitS
 		return;
 	}
 
-	std::vector<Entity*> targets = {};
+	ScopedTargetList scopedTargets{ context };
+	auto& targets = scopedTargets.targets;
 	if (this->m_usePickedTarget && branch.target != LWOOBJID_EMPTY) {
 		auto target = Game::entityManager->GetEntity(branch.target);
 		targets.push_back(target);
@@ -108,7 +110,9 @@ void TacArcBehavior::Calculate(BehaviorContext* context, RakNet::BitStream& bitS
 
 	targets.clear();
 
-	std::vector<Entity*> validTargets = Game::entityManager->GetEntitiesByProximity(reference, this->m_maxRange);
+	ScopedTargetList scopedValidTargets{ context };
+	auto& validTargets = scopedValidTargets.targets;
+	Game::entityManager->GetEntitiesByProximity(reference, this->m_maxRange, validTargets);
 
 	// filter all valid targets, based on whether we target enemies or friends
 	context->FilterTargets(validTargets, this->m_ignoreFactionList, this->m_includeFactionList, this->m_targetSelf, this->m_targetEnemy, this->m_targetFriend, this->m_targetTeam);
@@ -91,7 +91,9 @@ void BuffComponent::Update(float deltaTime) {
 			continue;
 		}
 
+		// The time left is only written on construction
 		buff.second.time -= deltaTime;
+		m_Parent->InvalidateConstruction();
 
 		if (buff.second.time <= 0.0f) {
 			RemoveBuff(buff.first);
@@ -103,6 +105,7 @@ void BuffComponent::Update(float deltaTime) {
 	for (const auto& buff : m_BuffsToRemove) {
 		m_Buffs.erase(buff);
 	}
+	m_Parent->InvalidateConstruction();
 
 	m_BuffsToRemove.clear();
 }
@@ -144,6 +147,7 @@ void BuffComponent::ApplyBuff(const int32_t id, const float duration, const LWOO
 	if (HasBuff(id)) {
 		m_Buffs[id].refCount++;
 		m_Buffs[id].time = duration;
+		m_Parent->InvalidateConstruction();
 		return;
 	}
 
@@ -193,6 +197,7 @@ void BuffComponent::ApplyBuff(const int32_t id, const float duration, const LWOO
 	buff.refCount = 1;
 
 	m_Buffs.emplace(id, buff);
+	m_Parent->InvalidateConstruction();
 
 	auto* parent = GetParent();
 	if (!cancelOnDeath) return;
@@ -310,6 +315,7 @@ void BuffComponent::RemoveAllBuffs() {
 	}
 
 	m_Buffs.clear();
+	m_Parent->InvalidateConstruction();
 }
 
 void BuffComponent::Reset() {
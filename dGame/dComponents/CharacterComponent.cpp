@@ -514,8 +514,8 @@ void CharacterComponent::TrackRaceCompleted(bool won) {
 		m_FirstPlaceRaceFinishes++;
 }
 
-void CharacterComponent::TrackPositionUpdate(const NiPoint3& newPosition) {
-	const auto distance = NiPoint3::Distance(newPosition, m_Parent->GetPosition());
+void CharacterComponent::TrackPositionUpdate(const NiPoint3& previousPosition, const NiPoint3& newPosition) {
+	const auto distance = NiPoint3::Distance(newPosition, previousPosition);
 
 	if (m_IsRacing) {
 		UpdatePlayerStatistic(DistanceDriven, static_cast<uint64_t>(distance));
@@ -245,8 +245,10 @@ public:
 
 	/**
 	 * Tracks an updated position for a player
+	 * @param previousPosition the position the player moved from
+	 * @param newPosition the position the player moved to
 	 */
-	void TrackPositionUpdate(const NiPoint3& newPosition);
+	void TrackPositionUpdate(const NiPoint3& previousPosition, const NiPoint3& newPosition);
 
 	/**
 	 * Handles a zone statistic update
@@ -238,9 +238,6 @@ void ControllablePhysicsComponent::SetIsOnRail(bool val) {
 	m_IsOnRail = val;
 }
 
-void ControllablePhysicsComponent::SetDirtyPosition(bool val) {
-	m_DirtyPosition = val;
-}
 void ControllablePhysicsComponent::AddPickupRadiusScale(float value) {
 	m_ActivePickupRadiusScales.push_back(value);
 	if (value > m_PickupRadius) {
@@ -98,12 +98,6 @@ public:
 	 */
 	const bool GetIsOnRail() const { return m_IsOnRail; }
 
-	/**
-	 * Mark the position as dirty, forcing a serialization update next tick
-	 * @param val whether or not the position is dirty
-	 */
-	void SetDirtyPosition(bool val);
-
 	/**
 	 * Sets whether or not the entity is currently wearing a jetpack
 	 * @param val whether or not the entity is currently wearing a jetpack
@@ -359,6 +359,7 @@ void DestroyableComponent::SetDamageReduction(int32_t value) {
 void DestroyableComponent::SetIsImmune(bool value) {
 	m_DirtyHealth = true;
 	m_ImmuneToBasicAttackCount = value ? 1 : 0;
+	m_Parent->InvalidateConstruction();
 }
 
 void DestroyableComponent::SetIsGMImmune(bool value) {
@@ -840,6 +841,9 @@ void DestroyableComponent::SetStatusImmunity(
 		if (bImmuneToPullToPoint) 			m_ImmuneToPullToPointCount += 1;
 	}
 
+	// Immunities are only written on construction
+	m_Parent->InvalidateConstruction();
+
 	GameMessages::SendSetStatusImmunity(
 		m_Parent->GetObjectID(), state, m_Parent->GetSystemAddress(),
 		bImmuneToBasicAttack,
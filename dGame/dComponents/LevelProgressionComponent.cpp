@@ -2,6 +2,7 @@
 #include "ControllablePhysicsComponent.h"
 #include "InventoryComponent.h"
 #include "CharacterComponent.h"
+#include "Character.h"
 #include "tinyxml2.h"
 
 #include "CDRewardsTable.h"
@@ -37,6 +38,15 @@ void LevelProgressionComponent::LoadFromXml(const tinyxml2::XMLDocument& doc) {
 	m_CharacterVersion = static_cast<eCharacterVersion>(characterVersion);
 }
 
+void LevelProgressionComponent::SetLevel(uint32_t level) {
+	m_Level = level;
+	m_DirtyLevelInfo = true;
+
+	// Preconditions can depend on the level
+	auto* character = m_Parent->GetCharacter();
+	if (character) character->ClearPreconditionCache();
+}
+
 void LevelProgressionComponent::Serialize(RakNet::BitStream& outBitStream, bool bIsInitialUpdate) {
 	outBitStream.Write(bIsInitialUpdate || m_DirtyLevelInfo);
 	if (bIsInitialUpdate || m_DirtyLevelInfo) outBitStream.Write(m_Level);
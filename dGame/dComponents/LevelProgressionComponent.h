@@ -45,7 +45,7 @@ public:
 	 * Sets the level of the entity
 	 * @param level the level to set
 	 */
-	void SetLevel(uint32_t level) { m_Level = level; m_DirtyLevelInfo = true; }
+	void SetLevel(uint32_t level);
 
 	/**
 	 * Gets the current Speed Base of the entity
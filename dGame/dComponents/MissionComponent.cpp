@@ -3,10 +3,12 @@
  * Copyright 2019
  */
 
+#include <ranges>
 #include <sstream>
 #include <string>
 
 #include "MissionComponent.h"
+#include "Character.h"
 #include "Logger.h"
 #include "CDClientManager.h"
 #include "CDMissionTasksTable.h"
@@ -142,22 +144,66 @@ void MissionComponent::RemoveMission(uint32_t missionId) {
 	delete mission;
 
 	m_Missions.erase(missionId);
+	RemoveFromIndex(missionId);
+
+	auto* character = m_Parent->GetCharacter();
+	if (character) character->ClearPreconditionCache();
 }
 
 void MissionComponent::Progress(eMissionTaskType type, int32_t value, LWOOBJID associate, const std::string& targets, int32_t count, bool ignoreAchievements) {
-	std::vector<uint32_t> acceptedAchievements;
+	// Copy the missions that can match before looking for achievements, the achievements accepted there are already progressed.
+	// Progress can also accept or remove missions, which would change the index while we go through it.
+	const auto indexed = m_MissionsByTaskType.find(type);
+	const auto missionIds = indexed != m_MissionsByTaskType.end() ? indexed->second : std::vector<uint32_t>();
+
 	if (count > 0 && !ignoreAchievements) {
-		acceptedAchievements = LookForAchievements(type, value, true, associate, targets, count);
+		LookForAchievements(type, value, true, associate, targets, count);
 	}
 
-	for (const auto& [id, mission] : m_Missions) {
-		if (!mission || std::find(acceptedAchievements.begin(), acceptedAchievements.end(), mission->GetMissionId()) != acceptedAchievements.end()) continue;
+	bool hasCompleted = false;
+	for (const auto missionId : missionIds) {
+		auto* mission = GetMission(missionId);
+		if (!mission || mission->IsComplete()) {
+			hasCompleted = true;
+			continue;
+		}
 
 		if (mission->IsAchievement() && ignoreAchievements) continue;
 
-		if (mission->IsComplete()) continue;
-
 		mission->Progress(type, value, associate, targets, count);
+
+		if (mission->IsComplete()) hasCompleted = true;
+	}
+
+	if (hasCompleted) {
+		// Drop the missions that completed, they get indexed again if they are accepted again
+		for (const auto missionId : missionIds) {
+			auto* mission = GetMission(missionId);
+			if (!mission || mission->IsComplete()) RemoveFromIndex(missionId);
+		}
+	}
+}
+
+void MissionComponent::IndexMission(Mission* mission) {
+	if (!mission || mission->IsComplete()) return;
+
+	if (!m_IndexedMissions.insert(mission->GetMissionId()).second) return;
+
+	for (const auto* task : mission->GetTasks()) {
+		auto& missionIds = m_MissionsByTaskType[task->GetType()];
+
+		// A mission can have more than one task of the same type
+		if (std::find(missionIds.begin(), missionIds.end(), mission->GetMissionId()) == missionIds.end()) {
+			missionIds.push_back(mission->GetMissionId());
+		}
+	}
+}
+
+void MissionComponent::RemoveFromIndex(const uint32_t missionId) {
+	if (m_IndexedMissions.erase(missionId) == 0) return;
+
+	for (auto& missionIds : m_MissionsByTaskType | std::views::values) {
+		std::erase(missionIds, missionId);
 	}
 }
 
@@ -548,6 +594,7 @@ void MissionComponent::LoadFromXml(const tinyxml2::XMLDocument& doc) {
 		currentM = currentM->NextSiblingElement();
 
 		m_Missions.insert_or_assign(missionId, mission);
+		IndexMission(mission);
 	}
 }
 
@@ -624,5 +671,10 @@ void MissionComponent::ResetMission(const int32_t missionId) {
 	if (!mission) return;
 
 	m_Missions.erase(missionId);
+	RemoveFromIndex(missionId);
+
+	auto* character = m_Parent->GetCharacter();
+	if (character) character->ClearPreconditionCache();
+
 	GameMessages::SendResetMissions(m_Parent, m_Parent->GetSystemAddress(), missionId);
 }
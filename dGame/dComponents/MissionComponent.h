@@ -7,6 +7,7 @@
 #define MISSIONCOMPONENT_H
 
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "dCommonVars.h"
 #include "RakNetTypes.h"
@@ -170,12 +171,36 @@ public:
 	bool HasMission(uint32_t missionId);
 
 	void ResetMission(const int32_t missionId);
+
+	/**
+	 * Adds a mission that is not complete to the task index, so progress for its task types reaches it.
+	 * Missions that complete are dropped from the index the next time their task types progress.
+	 * @param mission the mission to index
+	 */
+	void IndexMission(Mission* mission);
 private:
+	/**
+	 * Removes a mission from the task index
+	 * @param missionId the ID of the mission to remove
+	 */
+	void RemoveFromIndex(uint32_t missionId);
+
 	/**
 	 * All the missions owned by this entity, mapped by mission ID
 	 */
 	std::unordered_map<uint32_t, Mission*> m_Missions;
 
+	/**
+	 * The IDs of the missions that are not complete, mapped by the types of their tasks,
+	 * so progress only has to look at missions that can match it
+	 */
+	std::unordered_map<eMissionTaskType, std::vector<uint32_t>> m_MissionsByTaskType;
+
+	/**
+	 * The IDs of all the missions currently in m_MissionsByTaskType
+	 */
+	std::unordered_set<uint32_t> m_IndexedMissions;
+
 	/**
 	 * All the collectibles currently collected by the entity
 	 */
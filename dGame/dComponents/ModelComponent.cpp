@@ -67,7 +67,11 @@ void ModelComponent::Serialize(RakNet::BitStream& outBitStream, bool bIsInitialU
 }
 
 void ModelComponent::UpdatePendingBehaviorId(const int32_t newId) {
-	for (auto& behavior : m_Behaviors) if (behavior.GetBehaviorId() == -1) behavior.SetBehaviorId(newId);
+	for (auto& behavior : m_Behaviors) {
+		if (behavior.GetBehaviorId() != -1) continue;
+		behavior.SetBehaviorId(newId);
+		m_BehaviorsDirty = true;
+	}
 }
 
 void ModelComponent::SendBehaviorListToClient(AMFArrayValue& args) const {
@@ -95,11 +99,13 @@ void ModelComponent::AddBehavior(AddMessage& msg) {
 	for (auto& behavior : m_Behaviors) if (behavior.GetBehaviorId() == msg.GetBehaviorId()) return;
 	m_Behaviors.insert(m_Behaviors.begin() + msg.GetBehaviorIndex(), PropertyBehavior());
 	m_Behaviors.at(msg.GetBehaviorIndex()).HandleMsg(msg);
+	m_BehaviorsDirty = true;
 }
 
 void ModelComponent::MoveToInventory(MoveToInventoryMessage& msg) {
 	if (msg.GetBehaviorIndex() >= m_Behaviors.size() || m_Behaviors.at(msg.GetBehaviorIndex()).GetBehaviorId() != msg.GetBehaviorId()) return;
 	m_Behaviors.erase(m_Behaviors.begin() + msg.GetBehaviorIndex());
+	m_BehaviorsDirty = true;
 	// TODO move to the inventory
 }
 
@@ -122,3 +128,12 @@ std::array<std::pair<int32_t, std::string>, 5> ModelComponent::GetBehaviorsForSa
 	}
 	return toReturn;
 }
+
+std::array<int32_t, 5> ModelComponent::GetBehaviorIds() const {
+	std::array<int32_t, 5> toReturn{};
+	for (auto i = 0; i < m_Behaviors.size() && i < toReturn.size(); i++) {
+		const auto behaviorId = m_Behaviors.at(i).GetBehaviorId();
+		if (behaviorId != -1) toReturn[i] = behaviorId;
+	}
+	return toReturn;
+}
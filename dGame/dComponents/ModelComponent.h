@@ -67,6 +67,7 @@ public:
 	void HandleControlBehaviorsMsg(const AMFArrayValue& args) {
 		static_assert(std::is_base_of_v<BehaviorMessageBase, Msg>, "Msg must be a BehaviorMessageBase");
 		Msg msg(args);
+		m_BehaviorsDirty = true;
 		for (auto& behavior : m_Behaviors) {
 			if (behavior.GetBehaviorId() == msg.GetBehaviorId()) { 
 				behavior.HandleMsg(msg);
@@ -114,6 +115,14 @@ public:
 
 	std::array<std::pair<int32_t, std::string>, 5> GetBehaviorsForSave() const;
 
+	// Returns the behavior IDs in the same slots as GetBehaviorsForSave, without serializing the behaviors.
+	std::array<int32_t, 5> GetBehaviorIds() const;
+
+	// Whether the behaviors have changed since they were loaded or last saved to the database.
+	bool AreBehaviorsDirty() const { return m_BehaviorsDirty; }
+
+	void SetBehaviorsDirty(const bool value) { m_BehaviorsDirty = value; }
+
 private:
 	/**
 	 * The behaviors of the model
@@ -136,4 +145,9 @@ private:
 	 * The ID of the user that made the model
 	 */
 	LWOOBJID m_userModelID;
+
+	/**
+	 * Whether the behaviors need to be saved to the database
+	 */
+	bool m_BehaviorsDirty = false;
 };
@@ -1,4 +1,5 @@
 #include "ModuleAssemblyComponent.h"
+#include "Entity.h"
 
 ModuleAssemblyComponent::ModuleAssemblyComponent(Entity* parent) : Component(parent) {
 	m_SubKey = LWOOBJID_EMPTY;
@@ -12,6 +13,7 @@ ModuleAssemblyComponent::~ModuleAssemblyComponent() {
 
 void ModuleAssemblyComponent::SetSubKey(LWOOBJID value) {
 	m_SubKey = value;
+	m_Parent->InvalidateConstruction();
 }
 
 LWOOBJID ModuleAssemblyComponent::GetSubKey() const {
@@ -20,6 +22,7 @@ LWOOBJID ModuleAssemblyComponent::GetSubKey() const {
 
 void ModuleAssemblyComponent::SetUseOptionalParts(bool value) {
 	m_UseOptionalParts = value;
+	m_Parent->InvalidateConstruction();
 }
 
 bool ModuleAssemblyComponent::GetUseOptionalParts() const {
@@ -40,6 +43,7 @@ void ModuleAssemblyComponent::SetAssemblyPartsLOTs(const std::u16string& value)
 	val.push_back(';');
 
 	m_AssemblyPartsLOTs = val;
+	m_Parent->InvalidateConstruction();
 }
 
 const std::u16string& ModuleAssemblyComponent::GetAssemblyPartsLOTs() const {
@@ -12,6 +12,7 @@
 #include "CDClientManager.h"
 #include "Game.h"
 #include "dZoneManager.h"
+#include "dConfig.h"
 
 #include "CDComponentsRegistryTable.h"
 #include "CDPhysicsComponentTable.h"
@@ -54,6 +55,7 @@ MovementAIComponent::MovementAIComponent(Entity* parent, MovementAIInfo info) :
 	m_SourcePosition = m_Parent->GetPosition();
 	m_Paused = false;
 	m_SavedVelocity = NiPoint3Constant::ZERO;
+	m_SerializeEveryFrame = Game::config->GetValue("ai_serialize_every_frame") == "1";
 
 	if (!m_Parent->GetComponent<BaseCombatAIComponent>()) SetPath(m_Parent->GetVarAsString(u"attached_path"));
 }
@@ -95,10 +97,13 @@ void MovementAIComponent::Update(const float deltaTime) {
 
 		NiPoint3 velocity = (m_PullPoint - source) * speed;
 
-		SetPosition(source + velocity);
+		m_Parent->SetMovementPosition(source + velocity);
 
 		if (Vector3::DistanceSquared(m_Parent->GetPosition(), m_PullPoint) < std::pow(2, 2)) {
 			m_PullingToPoint = false;
+
+			// Observers that skipped movement updates get the final position now
+			Game::entityManager->SerializeEntity(m_Parent);
 		}
 
 		return;
@@ -117,7 +122,14 @@ void MovementAIComponent::Update(const float deltaTime) {
 
 	m_TimeTravelled += deltaTime;
 
-	SetPosition(ApproximateLocation());
+	if (m_SerializeEveryFrame) {
+		// Only the position changes between waypoints, the velocity lets clients extrapolate the rest
+		m_Parent->SetMovementPosition(ApproximateLocation());
+	} else {
+		// Clients extrapolate the segment from the position and velocity sent when it started,
+		// the server only keeps its physics close enough for proximity checks until the next waypoint
+		m_Parent->SetPhysicsPosition(InterpolateLocation());
+	}
 
 	if (m_TimeTravelled < m_TimeToTravel) return;
 	m_TimeTravelled = 0.0f;
@@ -197,6 +209,18 @@ NiPoint3 MovementAIComponent::GetCurrentWaypoint() const {
 }
 
 NiPoint3 MovementAIComponent::ApproximateLocation() const {
+	if (AtFinalWaypoint()) return m_SourcePosition;
+
+	auto approximation = InterpolateLocation();
+
+	if (dpWorld::IsLoaded()) {
+		approximation.y = dpWorld::GetNavMesh()->GetHeightAtPoint(approximation);
+	}
+
+	return approximation;
+}
+
+NiPoint3 MovementAIComponent::InterpolateLocation() const {
 	auto source = m_SourcePosition;
 
 	if (AtFinalWaypoint()) return source;
@@ -205,13 +229,7 @@ NiPoint3 MovementAIComponent::ApproximateLocation() const {
 
 	auto percentageToWaypoint = m_TimeToTravel > 0 ? m_TimeTravelled / m_TimeToTravel : 0;
 
-	auto approximation = source + ((destination - source) * percentageToWaypoint);
-
-	if (dpWorld::IsLoaded()) {
-		approximation.y = dpWorld::GetNavMesh()->GetHeightAtPoint(approximation);
-	}
-
-	return approximation;
+	return source + ((destination - source) * percentageToWaypoint);
 }
 
 bool MovementAIComponent::Warp(const NiPoint3& point) {
@@ -164,6 +164,13 @@ public:
 	 */
 	NiPoint3 ApproximateLocation() const;
 
+	/**
+	 * Returns the location of the entity on the straight line between its last and next waypoint,
+	 * without looking up the height of the navmesh
+	 * @return the interpolated location of the entity
+	 */
+	NiPoint3 InterpolateLocation() const;
+
 	/**
 	 * Teleports this entity to a position. If the distance between the provided point and the y it should have
 	 * according to map data, this will not succeed (to avoid teleporting entities into the sky).
@@ -321,6 +328,11 @@ private:
 	bool m_Paused;
 
 	NiPoint3 m_SavedVelocity;
+
+	/**
+	 * If the position is serialized every frame, instead of only when the entity starts moving towards a new waypoint
+	 */
+	bool m_SerializeEveryFrame;
 };
 
 #endif // MOVEMENTAICOMPONENT_H
@@ -25,6 +25,12 @@ public:
 
 	const NiQuaternion& GetRotation() const { return m_Rotation; }
 	virtual void SetRotation(const NiQuaternion& rot) { if (m_Rotation == rot) return; m_Rotation = rot; m_DirtyPosition = true; }
+
+	/**
+	 * Mark the position as dirty, forcing a serialization update next tick
+	 * @param val whether or not the position is dirty
+	 */
+	void SetDirtyPosition(bool val) { m_DirtyPosition = val; }
 protected:
 	dpEntity* CreatePhysicsEntity(eReplicaComponentType type);
 
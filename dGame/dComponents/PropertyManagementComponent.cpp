@@ -13,6 +13,7 @@
 #include "Game.h"
 #include "Item.h"
 #include "Database.h"
+#include "DatabaseTransaction.h"
 #include "ObjectIDManager.h"
 #include "RocketLaunchpadControlComponent.h"
 #include "PropertyEntranceComponent.h"
@@ -618,6 +619,8 @@ void PropertyManagementComponent::Load() {
 		auto* model = spawner->Spawn();
 
 		models.insert_or_assign(model->GetObjectID(), spawnerId);
+
+		savedModels[databaseModel.id] = SavedModel{ databaseModel.position, databaseModel.rotation, databaseModel.behaviors };
 	}
 }
 
@@ -632,68 +635,85 @@ void PropertyManagementComponent::Save() {
 	const auto* const character = owner->GetCharacter();
 	if (!character) return;
 
-	auto present = Database::Get()->GetPropertyModels(propertyId);
+	// Diff against what we last loaded or saved and write all changes in one transaction
+	std::map<LWOOBJID, SavedModel> currentModels;
+	// Behaviors are only marked as saved once the transaction committed, so a failed save retries them
+	std::vector<ModelComponent*> savedBehaviors;
 
-	std::vector<LWOOBJID> modelIds;
+	DatabaseTransaction transaction(*Database::Get());
 
 	for (const auto& pair : models) {
 		const auto id = pair.second;
 
-		modelIds.push_back(id);
-
 		auto* entity = Game::entityManager->GetEntity(pair.first);
+		auto* modelComponent = entity ? entity->GetComponent<ModelComponent>() : nullptr;
 
-		if (entity == nullptr) {
+		const auto saved = savedModels.find(id);
+		if (!modelComponent) {
+			// Keep whatever is stored for models we can't read right now
+			if (saved != savedModels.end()) currentModels.insert(*saved);
 			continue;
 		}
-		auto* modelComponent = entity->GetComponent<ModelComponent>();
-		if (!modelComponent) continue;
-		const auto modelBehaviors = modelComponent->GetBehaviorsForSave();
-
-		// save the behaviors of the model
-		for (const auto& [behaviorId, behaviorStr] : modelBehaviors) {
-			if (behaviorStr.empty() || behaviorId == -1 || behaviorId == 0) continue;
-			IBehaviors::Info info {
-				.behaviorId = behaviorId,
-				.characterId = character->GetID(),
-				.behaviorInfo = behaviorStr
-			};
-			Database::Get()->AddBehavior(info);
-		}
 
-		const auto position = entity->GetPosition();
-		const auto rotation = entity->GetRotation();
+		SavedModel current{ entity->GetPosition(), entity->GetRotation(), modelComponent->GetBehaviorIds() };
+
+		// save the behaviors of the model, only serializing them if they were edited
+		if (modelComponent->AreBehaviorsDirty()) {
+			for (const auto& [behaviorId, behaviorStr] : modelComponent->GetBehaviorsForSave()) {
+				if (behaviorStr.empty() || behaviorId == -1 || behaviorId == 0) continue;
+				IBehaviors::Info info {
+					.behaviorId = behaviorId,
+					.characterId = character->GetID(),
+					.behaviorInfo = behaviorStr
+				};
+				Database::Get()->AddBehavior(info);
+			}
+			savedBehaviors.push_back(modelComponent);
+		}
 
-		if (std::find(present.begin(), present.end(), id) == present.end()) {
+		if (saved == savedModels.end()) {
 			IPropertyContents::Model model;
 			model.id = id;
 			model.lot = entity->GetLOT();
-			model.position = position;
-			model.rotation = rotation;
+			model.position = current.position;
+			model.rotation = current.rotation;
 			model.ugcId = 0;
-			for (auto i = 0; i < model.behaviors.size(); i++) {
-				model.behaviors[i] = modelBehaviors[i].first;
-			}
+			model.behaviors = current.behaviors;
 
 			Database::Get()->InsertNewPropertyModel(propertyId, model, "Objects_" + std::to_string(model.lot) + "_name");
-		} else {
-			Database::Get()->UpdateModel(id, position, rotation, modelBehaviors);
+		} else if (saved->second.position != current.position || saved->second.rotation != current.rotation || saved->second.behaviors != current.behaviors) {
+			std::array<std::pair<int32_t, std::string>, 5> behaviors{};
+			for (auto i = 0; i < behaviors.size(); i++) {
+				behaviors[i].first = current.behaviors[i];
+			}
+
+			Database::Get()->UpdateModel(id, current.position, current.rotation, behaviors);
 		}
+
+		currentModels[id] = current;
 	}
 
-	for (auto model : present) {
-		if (std::find(modelIds.begin(), modelIds.end(), model.id) != modelIds.end()) {
-			continue;
-		}
+	for (const auto& [id, saved] : savedModels) {
+		if (currentModels.contains(id)) continue;
 
-		Database::Get()->RemoveModel(model.id);
+		Database::Get()->RemoveModel(id);
 	}
+
+	transaction.Commit();
+
+	for (auto* const modelComponent : savedBehaviors) modelComponent->SetBehaviorsDirty(false);
+	savedModels = std::move(currentModels);
 }
 
 void PropertyManagementComponent::AddModel(LWOOBJID modelId, LWOOBJID spawnerId) {
 	models[modelId] = spawnerId;
 }
 
+void PropertyManagementComponent::AddSavedModel(LWOOBJID modelId, LWOOBJID spawnerId, const NiPoint3& position, const NiQuaternion& rotation) {
+	models[modelId] = spawnerId;
+	savedModels[spawnerId] = SavedModel{ position, rotation };
+}
+
 PropertyManagementComponent* PropertyManagementComponent::Instance() {
 	return instance;
 }
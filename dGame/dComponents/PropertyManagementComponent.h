@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include "Entity.h"
 #include "Component.h"
@@ -154,6 +155,15 @@ public:
 	 */
 	void AddModel(LWOOBJID modelId, LWOOBJID spawnerId);
 
+	/**
+	 * Adds a model that was already inserted into the database, so the next save doesn't insert it again
+	 * @param modelId the ID of the model
+	 * @param spawnerId the ID of the object that spawned the model, the ID of the model in the database
+	 * @param position the position the model was stored with
+	 * @param rotation the rotation the model was stored with
+	 */
+	void AddSavedModel(LWOOBJID modelId, LWOOBJID spawnerId, const NiPoint3& position, const NiQuaternion& rotation);
+
 	/**
 	 * Returns all the models on this property, indexed by property ID, containing their spawn objects
 	 * @return all the models on this proeprty
@@ -195,6 +205,20 @@ private:
 	 */
 	std::map<LWOOBJID, LWOOBJID> models = {};
 
+	/**
+	 * The state of a model as it is currently stored in the database
+	 */
+	struct SavedModel {
+		NiPoint3 position;
+		NiQuaternion rotation;
+		std::array<int32_t, 5> behaviors{};
+	};
+
+	/**
+	 * The models as they are currently stored in the database, indexed by model ID, used to only save what changed
+	 */
+	std::map<LWOOBJID, SavedModel> savedModels = {};
+
 	/**
 	 * The name of this property
 	 */
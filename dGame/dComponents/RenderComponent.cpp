@@ -68,6 +68,7 @@ void RenderComponent::Serialize(RakNet::BitStream& outBitStream, bool bIsInitial
 }
 
 Effect& RenderComponent::AddEffect(const int32_t effectId, const std::string& name, const std::u16string& type, const float priority) {
+	m_Parent->InvalidateConstruction();
 	return m_Effects.emplace_back(effectId, name, type, priority);
 }
 
@@ -77,6 +78,7 @@ void RenderComponent::RemoveEffect(const std::string& name) {
 	const auto effectToRemove = std::ranges::find_if(m_Effects, [&name](auto&& effect) { return effect.name == name; });
 	if (effectToRemove == m_Effects.end()) return; // Return early if effect is not present
 
+	m_Parent->InvalidateConstruction();
 	const auto lastEffect = m_Effects.rbegin();
 	*effectToRemove = std::move(*lastEffect); // Move-overwrite
 	m_Effects.pop_back();
@@ -32,6 +32,11 @@ SimplePhysicsComponent::SimplePhysicsComponent(Entity* parent, uint32_t componen
 SimplePhysicsComponent::~SimplePhysicsComponent() {
 }
 
+void SimplePhysicsComponent::SetClimbableType(const eClimbableType& value) {
+	m_ClimbableType = value;
+	m_Parent->InvalidateConstruction();
+}
+
 void SimplePhysicsComponent::Serialize(RakNet::BitStream& outBitStream, bool bIsInitialUpdate) {
 	if (bIsInitialUpdate) {
 		outBitStream.Write(m_ClimbableType != eClimbableType::CLIMBABLE_TYPE_NOT);
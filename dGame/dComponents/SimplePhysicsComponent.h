@@ -81,7 +81,7 @@ public:
 	 * Sets the ClimbableType of this entity
 	 * @param value the ClimbableType to set
 	 */
-	void SetClimbableType(const eClimbableType& value) { m_ClimbableType = value; }
+	void SetClimbableType(const eClimbableType& value);
 
 private:
 	/**
@@ -32,7 +32,7 @@ ProjectileSyncEntry::ProjectileSyncEntry() {
 std::unordered_map<uint32_t, uint32_t> SkillComponent::m_skillBehaviorCache = {};
 
 bool SkillComponent::CastPlayerSkill(const uint32_t behaviorId, const uint32_t skillUid, RakNet::BitStream& bitStream, const LWOOBJID target, uint32_t skillID) {
-	auto* context = new BehaviorContext(this->m_Parent->GetObjectID());
+	auto* context = BehaviorContextPool::Acquire(this->m_Parent->GetObjectID());
 
 	context->caster = m_Parent->GetObjectID();
 
@@ -55,7 +55,7 @@ void SkillComponent::SyncPlayerSkill(const uint32_t skillUid, const uint32_t syn
 	const auto index = this->m_managedBehaviors.equal_range(skillUid);
 
 	if (index.first == this->m_managedBehaviors.end()) {
-		LOG("Failed to find skill with uid (%i)!", skillUid, syncId);
+		LOG("Failed to find skill with uid (%i) for sync (%i)!", skillUid, syncId);
 
 		return;
 	}
@@ -173,9 +173,7 @@ void SkillComponent::Update(const float deltaTime) {
 			}
 
 			if (!any) {
-				context->Reset();
-
-				delete context;
+				BehaviorContextPool::Release(context);
 
 				context = nullptr;
 
@@ -191,7 +189,7 @@ void SkillComponent::Update(const float deltaTime) {
 
 void SkillComponent::Reset() {
 	for (const auto& behavior : this->m_managedBehaviors) {
-		delete behavior.second;
+		BehaviorContextPool::Release(behavior.second);
 	}
 
 	this->m_managedProjectiles.clear();
@@ -271,7 +269,7 @@ SkillExecutionResult SkillComponent::CalculateBehavior(
 
 	auto* behavior = Behavior::CreateBehavior(behaviorId);
 
-	auto* context = new BehaviorContext(originatorOverride != LWOOBJID_EMPTY ? originatorOverride : this->m_Parent->GetObjectID(), true);
+	auto* context = BehaviorContextPool::Acquire(originatorOverride != LWOOBJID_EMPTY ? originatorOverride : this->m_Parent->GetObjectID(), true);
 
 	context->caster = m_Parent->GetObjectID();
 
@@ -286,7 +284,7 @@ SkillExecutionResult SkillComponent::CalculateBehavior(
 	m_Parent->GetScript()->OnSkillCast(m_Parent, skillId);
 
 	if (!context->foundTarget) {
-		delete context;
+		BehaviorContextPool::Release(context);
 
 		// Invalid attack
 		return { false, 0 };
@@ -461,26 +459,30 @@ void SkillComponent::SyncProjectileCalculation(const ProjectileSyncEntry& entry)
 }
 
 void SkillComponent::HandleUnmanaged(const uint32_t behaviorId, const LWOOBJID target, LWOOBJID source) {
-	BehaviorContext context{ source };
+	auto* context = BehaviorContextPool::Acquire(source);
 
-	context.unmanaged = true;
-	context.caster = target;
+	context->unmanaged = true;
+	context->caster = target;
 
 	auto* behavior = Behavior::CreateBehavior(behaviorId);
 
 	RakNet::BitStream bitStream{};
 
-	behavior->Handle(&context, bitStream, { target });
+	behavior->Handle(context, bitStream, { target });
+
+	BehaviorContextPool::Release(context);
 }
 
 void SkillComponent::HandleUnCast(const uint32_t behaviorId, const LWOOBJID target) {
-	BehaviorContext context{ target };
+	auto* context = BehaviorContextPool::Acquire(target);
 
-	context.caster = target;
+	context->caster = target;
 
 	auto* behavior = Behavior::CreateBehavior(behaviorId);
 
-	behavior->UnCast(&context, { target });
+	behavior->UnCast(context, { target });
+
+	BehaviorContextPool::Release(context);
 }
 
 SkillComponent::SkillComponent(Entity* parent) : Component(parent) {
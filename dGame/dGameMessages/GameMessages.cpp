@@ -129,6 +129,9 @@ void GameMessages::SendFireEventClientSide(const LWOOBJID& objectID, const Syste
 }
 
 void GameMessages::SendTeleport(const LWOOBJID& objectID, const NiPoint3& pos, const NiQuaternion& rot, const SystemAddress& sysAddr, bool bSetRotation) {
+	// A position the client sent before the teleport must not move the player back
+	Game::entityManager->DropPositionUpdate(objectID);
+
 	CBITSTREAM;
 	CMSGHEADER;
 	bitStream.Write(objectID);
@@ -194,7 +197,7 @@ void GameMessages::SendPlayAnimation(Entity* entity, const std::u16string& anima
 	bitStream.Write(fScale != 1.0f);
 	if (fScale != 1.0f) bitStream.Write(fScale);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendPlayerReady(Entity* entity, const SystemAddress& sysAddr) {
@@ -260,7 +263,7 @@ void GameMessages::SendKnockback(const LWOOBJID& objectID, const LWOOBJID& caste
 	if (knockBackTimeMSFlag) bitStream.Write(knockBackTimeMS);
 	bitStream.Write(vector);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(objectID);
 }
 
 void GameMessages::SendStartArrangingWithItem(
@@ -337,7 +340,7 @@ void GameMessages::SendPlayNDAudioEmitter(Entity* entity, const SystemAddress& s
 	bitStream.Write0(); // result {bool}
 	bitStream.Write0(); // m_TargetObjectIDForNDAudioCallbackMessages {lwoobjid}
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendStartPathing(Entity* entity) {
@@ -347,7 +350,7 @@ void GameMessages::SendStartPathing(Entity* entity) {
 	bitStream.Write(entity->GetObjectID());
 	bitStream.Write(eGameMessageType::START_PATHING);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendResetMissions(Entity* entity, const SystemAddress& sysAddr, const int32_t missionid) {
@@ -414,7 +417,7 @@ void GameMessages::SendPlatformResync(Entity* entity, const SystemAddress& sysAd
 		bitStream.Write(qUnexpectedRotation.w);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(entity->GetObjectID());
 	SEND_PACKET;
 }
 
@@ -532,7 +535,7 @@ void GameMessages::SendChangeObjectWorldState(const LWOOBJID& objectID, eObjectW
 	bitStream.Write(eGameMessageType::CHANGE_OBJECT_WORLD_STATE);
 	bitStream.Write(state);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID)
 		SEND_PACKET;
 }
 
@@ -681,7 +684,7 @@ void GameMessages::SendPlayEmbeddedEffectOnAllClientsNearObject(Entity* entity,
 	bitStream.Write(fromObjectID);
 	bitStream.Write(radius);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendPlayFXEffect(Entity* entity, int32_t effectID, const std::u16string& effectType, const std::string& name, LWOOBJID secondary, float priority, float scale, bool serialize) {
@@ -719,7 +722,7 @@ void GameMessages::SendPlayFXEffect(const LWOOBJID& entity, int32_t effectID, co
 
 	bitStream.Write(serialize);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity);
 }
 
 void GameMessages::SendStopFXEffect(Entity* entity, bool killImmediate, std::string name) {
@@ -733,7 +736,7 @@ void GameMessages::SendStopFXEffect(Entity* entity, bool killImmediate, std::str
 	bitStream.Write<uint32_t>(name.size());
 	bitStream.Write(name.c_str(), name.size());
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendBroadcastTextToChatbox(Entity* entity, const SystemAddress& sysAddr, const std::u16string& attrs, const std::u16string& wsText) {
@@ -803,7 +806,7 @@ void GameMessages::SendQuickBuildNotifyState(Entity* entity, eQuickBuildState pr
 	bitStream.Write(state);
 	bitStream.Write(playerID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendEnableQuickBuild(Entity* entity, bool enable, bool fail, bool success, eQuickBuildFailReason failReason, float duration, const LWOOBJID& playerID) {
@@ -823,7 +826,7 @@ void GameMessages::SendEnableQuickBuild(Entity* entity, bool enable, bool fail,
 	bitStream.Write(duration);
 	bitStream.Write(playerID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendTerminateInteraction(const LWOOBJID& objectID, eTerminateType type, const LWOOBJID& terminator) {
@@ -836,7 +839,7 @@ void GameMessages::SendTerminateInteraction(const LWOOBJID& objectID, eTerminate
 	bitStream.Write(terminator);
 	bitStream.Write(type);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(objectID);
 }
 
 void GameMessages::SendDieNoImplCode(Entity* entity, const LWOOBJID& killerID, const LWOOBJID& lootOwnerID, eKillType killType, std::u16string deathType, float directionRelative_AngleY, float directionRelative_AngleXZ, float directionRelative_Force, bool bClientDeath, bool bSpawnLoot) {
@@ -858,7 +861,7 @@ void GameMessages::SendDieNoImplCode(Entity* entity, const LWOOBJID& killerID, c
 	bitStream.Write(killerID);
 	bitStream.Write(lootOwnerID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendDie(Entity* entity, const LWOOBJID& killerID, const LWOOBJID& lootOwnerID, bool bDieAccepted, eKillType killType, std::u16string deathType, float directionRelative_AngleY, float directionRelative_AngleXZ, float directionRelative_Force, bool bClientDeath, bool bSpawnLoot, float coinSpawnTime) {
@@ -895,7 +898,7 @@ void GameMessages::SendDie(Entity* entity, const LWOOBJID& killerID, const LWOOB
 		bitStream.Write(lootOwnerID);
 	}
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendSetInventorySize(Entity* entity, int invType, int size) {
@@ -958,7 +961,7 @@ void GameMessages::SendSetJetPackMode(Entity* entity, bool use, bool bypassCheck
 	bitStream.Write(warningEffectID != -1);
 	if (warningEffectID != -1) bitStream.Write(warningEffectID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendResurrect(Entity* entity) {
@@ -993,7 +996,7 @@ void GameMessages::SendResurrect(Entity* entity) {
 	bitStream.Write(eGameMessageType::RESURRECT);
 	bitStream.Write(bRezImmediately);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendStop2DAmbientSound(Entity* entity, bool force, std::string audioGUID, bool result) {
@@ -1055,7 +1058,7 @@ void GameMessages::SendSetNetworkScriptVar(Entity* entity, const SystemAddress&
 	}
 	if (dataSize > 0) bitStream.Write<uint16_t>(0);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(entity->GetObjectID());
 	SEND_PACKET;
 }
 
@@ -1324,7 +1327,7 @@ void GameMessages::SendVendorStatusUpdate(Entity* entity, const SystemAddress& s
 		bitStream.Write(item.sortPriority);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(entity->GetObjectID());
 	SEND_PACKET;
 }
 
@@ -1546,7 +1549,7 @@ void GameMessages::SendActivityPause(LWOOBJID objectId, bool pause, const System
 	bitStream.Write(eGameMessageType::ACTIVITY_PAUSE);
 	bitStream.Write(pause);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -1558,7 +1561,7 @@ void GameMessages::SendStartActivityTime(LWOOBJID objectId, float_t startTime, c
 	bitStream.Write(eGameMessageType::START_ACTIVITY_TIME);
 	bitStream.Write<float_t>(startTime);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -1571,7 +1574,7 @@ void GameMessages::SendRequestActivityEnter(LWOOBJID objectId, const SystemAddre
 	bitStream.Write<bool>(bStart);
 	bitStream.Write<LWOOBJID>(userID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -1622,7 +1625,7 @@ void GameMessages::SendSetShootingGalleryParams(LWOOBJID objectId, const SystemA
 	bitStream.Write<bool>(bUseLeaderboards);
 	bitStream.Write<float>(timeLimit);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -1642,7 +1645,7 @@ void GameMessages::SendNotifyClientShootingGalleryScore(LWOOBJID objectId, const
 	bitStream.Write<LWOOBJID>(target);
 	bitStream.Write<NiPoint3>(targetPos);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -1781,7 +1784,7 @@ void GameMessages::SendSetRailMovement(const LWOOBJID& objectID, bool pathGoForw
 	if (!activatorObjectIDIsDefault)
 		bitStream.Write<LWOOBJID>(railActivatorObjectID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID);
 	SEND_PACKET;
 }
 
@@ -1845,7 +1848,7 @@ void GameMessages::SendStartRailMovement(const LWOOBJID& objectID, std::u16strin
 
 	bitStream.Write(useDB);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID);
 	SEND_PACKET;
 }
 
@@ -1872,7 +1875,7 @@ void GameMessages::SendNotifyClientObject(const LWOOBJID& objectID, std::u16stri
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID);
 	SEND_PACKET;
 }
 
@@ -1946,7 +1949,7 @@ void GameMessages::SendSetName(LWOOBJID objectID, std::u16string name, const Sys
 	for (size_t i = 0; i < name.size(); ++i)
 		bitStream.Write(name[i]);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID);
 	SEND_PACKET;
 }
 
@@ -1983,7 +1986,7 @@ void GameMessages::SendOpenPropertyVendor(const LWOOBJID objectId, const SystemA
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::OPEN_PROPERTY_VENDOR);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2009,7 +2012,7 @@ void GameMessages::SendDownloadPropertyData(const LWOOBJID objectId, const Prope
 
 	LOG("(%llu) sending property data (%d)", objectId, sysAddr == UNASSIGNED_SYSTEM_ADDRESS);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2025,7 +2028,7 @@ void GameMessages::SendPropertyRentalResponse(const LWOOBJID objectId, const LWO
 	bitStream.Write(propertyId);
 	bitStream.Write(rentDue);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2041,7 +2044,7 @@ void GameMessages::SendLockNodeRotation(Entity* entity, std::string nodeName) {
 		bitStream.Write(character);
 	}
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendSetBuildModeConfirmed(LWOOBJID objectId, const SystemAddress& sysAddr, bool start, bool warnVisitors, bool modePaused, int32_t modeValue, LWOOBJID playerId, NiPoint3 startPos) {
@@ -2060,7 +2063,7 @@ void GameMessages::SendSetBuildModeConfirmed(LWOOBJID objectId, const SystemAddr
 	bitStream.Write1();
 	bitStream.Write(startPos);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2080,7 +2083,7 @@ void GameMessages::SendGetModelsOnProperty(LWOOBJID objectId, std::map<LWOOBJID,
 
 	LOG("Sending property models to (%llu) (%d)", objectId, sysAddr == UNASSIGNED_SYSTEM_ADDRESS);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2094,7 +2097,7 @@ void GameMessages::SendZonePropertyModelEquipped(LWOOBJID objectId, LWOOBJID pla
 	bitStream.Write(playerId);
 	bitStream.Write(propertyId);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2126,7 +2129,7 @@ void GameMessages::SendPlaceModelResponse(LWOOBJID objectId, const SystemAddress
 		bitStream.Write(response);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 
 }
@@ -2141,7 +2144,7 @@ void GameMessages::SendUGCEquipPreCreateBasedOnEditMode(LWOOBJID objectId, const
 	bitStream.Write(modelCount);
 	bitStream.Write(model);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2159,7 +2162,7 @@ void GameMessages::SendUGCEquipPostDeleteBasedOnEditMode(LWOOBJID objectId, cons
 		bitStream.Write(itemTotal);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2471,7 +2474,7 @@ void GameMessages::SendSmash(Entity* entity, float force, float ghostOpacity, LW
 	bitStream.Write(ghostOpacity);
 	bitStream.Write(killerID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendUnSmash(Entity* entity, LWOOBJID builderID, float duration) {
@@ -2487,13 +2490,25 @@ void GameMessages::SendUnSmash(Entity* entity, LWOOBJID builderID, float duratio
 	bitStream.Write(duration != 3.0f);
 	if (duration != 3.0f) bitStream.Write(duration);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::HandleControlBehaviors(RakNet::BitStream& inStream, Entity* entity, const SystemAddress& sysAddr) {
+	// The arguments are only needed while the command is processed, free them all at once afterwards
+	AMFArena arena;
 	AMFDeserialize reader;
-	std::unique_ptr<AMFArrayValue> amfArguments{ static_cast<AMFArrayValue*>(reader.Read(inStream)) };
-	if (amfArguments->GetValueType() != eAmf::Array) return;
+	const AMFBaseValue* amfValue = nullptr;
+	try {
+		amfValue = reader.Read(inStream, arena);
+	} catch (const std::exception& e) {
+		LOG("Failed to read control behavior arguments: %s", e.what());
+		return;
+	} catch (const eAmf marker) {
+		LOG("Failed to read control behavior arguments, unsupported AMF marker %i", marker);
+		return;
+	}
+	if (amfValue->GetValueType() != eAmf::Array) return;
+	const auto* const amfArguments = static_cast<const AMFArrayValue*>(amfValue);
 
 	uint32_t commandLength{};
 	inStream.Read(commandLength);
@@ -2679,7 +2694,8 @@ void GameMessages::HandleBBBSaveRequest(RakNet::BitStream& inStream, Entity* ent
 			//Make sure the propMgmt doesn't delete our model after the server dies
 			//Trying to do this after the entity is constructed. Shouldn't really change anything but
 			//there was an issue with builds not appearing since it was placed above ConstructEntity.
-			PropertyManagementComponent::Instance()->AddModel(newEntity->GetObjectID(), newIDL);
+			//The model is already in the database, so the next save must not insert it again.
+			PropertyManagementComponent::Instance()->AddSavedModel(newEntity->GetObjectID(), newIDL, model.position, model.rotation);
 		}
 
 		});
@@ -2918,7 +2934,7 @@ void GameMessages::SendSetStunned(LWOOBJID objectId, eStateChangeType stateChang
 
 	bitStream.Write(bIgnoreImmunity);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2950,7 +2966,7 @@ void GameMessages::SendSetStunImmunity(LWOOBJID target, eStateChangeType state,
 	bitStream.Write(bImmuneToStunTurn);
 	bitStream.Write(bImmuneToStunUseItem);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(target);
 	SEND_PACKET;
 }
 
@@ -2982,7 +2998,7 @@ void GameMessages::SendSetStatusImmunity(LWOOBJID objectId, eStateChangeType sta
 	bitStream.Write(bImmuneToQuickbuildInterrupt);
 	bitStream.Write(bImmuneToPullToPoint);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -2996,7 +3012,7 @@ void GameMessages::SendOrientToAngle(LWOOBJID objectId, bool bRelativeToCurrent,
 	bitStream.Write(bRelativeToCurrent);
 	bitStream.Write(fAngle);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3014,7 +3030,7 @@ void GameMessages::SendAddRunSpeedModifier(LWOOBJID objectId, LWOOBJID caster, u
 	bitStream.Write(modifier != 500);
 	if (modifier != 500) bitStream.Write(modifier);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3028,7 +3044,7 @@ void GameMessages::SendRemoveRunSpeedModifier(LWOOBJID objectId, uint32_t modifi
 	bitStream.Write(modifier != 500);
 	if (modifier != 500) bitStream.Write(modifier);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3039,7 +3055,7 @@ void GameMessages::SendPropertyEntranceBegin(LWOOBJID objectId, const SystemAddr
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::PROPERTY_ENTRANCE_BEGIN);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3062,7 +3078,7 @@ void GameMessages::SendPropertySelectQuery(LWOOBJID objectId, int32_t navOffset,
 		entry.Serialize(bitStream);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3082,7 +3098,7 @@ void GameMessages::SendNotifyObject(LWOOBJID objectId, LWOOBJID objIDSender, std
 	bitStream.Write(param1);
 	bitStream.Write(param2);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3116,7 +3132,7 @@ void GameMessages::SendTeamPickupItem(LWOOBJID objectId, LWOOBJID lootID, LWOOBJ
 	bitStream.Write(lootID);
 	bitStream.Write(lootOwnerID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3136,7 +3152,7 @@ void GameMessages::SendServerTradeInvite(LWOOBJID objectId, bool bNeedInvitePopU
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3154,7 +3170,7 @@ void GameMessages::SendServerTradeInitialReply(LWOOBJID objectId, LWOOBJID i64In
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3172,7 +3188,7 @@ void GameMessages::SendServerTradeFinalReply(LWOOBJID objectId, bool bResult, LW
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3185,7 +3201,7 @@ void GameMessages::SendServerTradeAccept(LWOOBJID objectId, bool bFirst, const S
 
 	bitStream.Write(bFirst);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3196,7 +3212,7 @@ void GameMessages::SendServerTradeCancel(LWOOBJID objectId, const SystemAddress&
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::SERVER_TRADE_CANCEL);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3225,7 +3241,7 @@ void GameMessages::SendServerTradeUpdate(LWOOBJID objectId, uint64_t coins, cons
 		bitStream.Write0();
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3396,7 +3412,7 @@ void GameMessages::SendNotifyPetTamingMinigame(LWOOBJID objectId, LWOOBJID petId
 	bitStream.Write(hasDefault);
 	if (hasDefault) bitStream.Write(teleRot);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3407,7 +3423,7 @@ void GameMessages::SendNotifyTamingModelLoadedOnServer(LWOOBJID objectId, const
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::NOTIFY_TAMING_MODEL_LOADED_ON_SERVER);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3424,7 +3440,7 @@ void GameMessages::SendNotifyPetTamingPuzzleSelected(LWOOBJID objectId, const st
 		bitStream.Write(brick.materialID);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3439,7 +3455,7 @@ void GameMessages::SendPetTamingTryBuildResult(LWOOBJID objectId, bool bSuccess,
 	bitStream.Write(iNumCorrect != 0);
 	if (iNumCorrect != 0) bitStream.Write(iNumCorrect);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3455,7 +3471,7 @@ void GameMessages::SendPetResponse(LWOOBJID objectId, LWOOBJID objIDPet, int32_t
 	bitStream.Write(iResponse);
 	bitStream.Write(iTypeID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3475,7 +3491,7 @@ void GameMessages::SendAddPetToPlayer(LWOOBJID objectId, int32_t iElementalType,
 	bitStream.Write(petDBID);
 	bitStream.Write(petLOT);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3488,7 +3504,7 @@ void GameMessages::SendRegisterPetID(LWOOBJID objectId, LWOOBJID objID, const Sy
 
 	bitStream.Write(objID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3501,7 +3517,7 @@ void GameMessages::SendRegisterPetDBID(LWOOBJID objectId, LWOOBJID petDBID, cons
 
 	bitStream.Write(petDBID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3520,7 +3536,7 @@ void GameMessages::SendMarkInventoryItemAsActive(LWOOBJID objectId, bool bActive
 	bitStream.Write(itemID != LWOOBJID_EMPTY);
 	if (itemID != LWOOBJID_EMPTY) bitStream.Write(itemID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3533,7 +3549,7 @@ void GameMessages::SendClientExitTamingMinigame(LWOOBJID objectId, bool bVolunta
 
 	bitStream.Write(bVoluntaryExit);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3547,7 +3563,7 @@ void GameMessages::SendShowPetActionButton(const LWOOBJID objectId, const ePetAb
 	bitStream.Write(petAbility);
 	bitStream.Write(bShow);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3561,7 +3577,7 @@ void GameMessages::SendPlayEmote(LWOOBJID objectId, int32_t emoteID, LWOOBJID ta
 	bitStream.Write(emoteID);
 	bitStream.Write(target);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3577,7 +3593,7 @@ void GameMessages::SendRemoveBuff(Entity* entity, bool fromUnEquip, bool removeI
 	bitStream.Write(removeImmunity);
 	bitStream.Write(buffId);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 void GameMessages::SendBouncerActiveStatus(LWOOBJID objectId, bool bActive, const SystemAddress& sysAddr) {
@@ -3589,7 +3605,7 @@ void GameMessages::SendBouncerActiveStatus(LWOOBJID objectId, bool bActive, cons
 
 	bitStream.Write(bActive);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3609,7 +3625,7 @@ void GameMessages::SendSetPetName(LWOOBJID objectId, std::u16string name, LWOOBJ
 	bitStream.Write(petDBID != LWOOBJID_EMPTY);
 	if (petDBID != LWOOBJID_EMPTY) bitStream.Write(petDBID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3626,7 +3642,7 @@ void GameMessages::SendSetPetNameModerated(LWOOBJID objectId, LWOOBJID petDBID,
 
 	bitStream.Write(nModerationStatus);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3650,7 +3666,7 @@ void GameMessages::SendPetNameChanged(LWOOBJID objectId, int32_t moderationStatu
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3909,7 +3925,7 @@ void GameMessages::SendNotifyNotEnoughInvSpace(LWOOBJID objectId, uint32_t freeS
 	bitStream.Write(inventoryType != 0);
 	if (inventoryType != 0) bitStream.Write(inventoryType);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3957,7 +3973,7 @@ void GameMessages::SendDisplayChatBubble(LWOOBJID objectId, const std::u16string
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -3973,7 +3989,7 @@ void GameMessages::SendChangeIdleFlags(LWOOBJID objectId, eAnimationFlags flagsO
 	bitStream.Write<bool>(flagsOn != eAnimationFlags::IDLE_NONE);
 	if (flagsOn != eAnimationFlags::IDLE_NONE) bitStream.Write(flagsOn);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(objectId);
 }
 // Mounts
 
@@ -3984,7 +4000,7 @@ void GameMessages::SendSetMountInventoryID(Entity* entity, const LWOOBJID& objec
 	bitStream.Write(eGameMessageType::SET_MOUNT_INVENTORY_ID);
 	bitStream.Write(objectID);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(entity->GetObjectID());
 }
 
 
@@ -4265,7 +4281,7 @@ void GameMessages::SendModuleAssemblyDBDataForClient(LWOOBJID objectId, LWOOBJID
 		bitStream.Write(character);
 	}
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4280,7 +4296,7 @@ void GameMessages::SendNotifyVehicleOfRacingObject(LWOOBJID objectId, LWOOBJID r
 	bitStream.Write(racingObjectID != LWOOBJID_EMPTY);
 	if (racingObjectID != LWOOBJID_EMPTY) bitStream.Write(racingObjectID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4295,7 +4311,7 @@ void GameMessages::SendRacingPlayerLoaded(LWOOBJID objectId, LWOOBJID playerID,
 	bitStream.Write(playerID);
 	bitStream.Write(vehicleID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4309,7 +4325,7 @@ void GameMessages::SendVehicleUnlockInput(LWOOBJID objectId, bool bLockWheels, c
 
 	bitStream.Write(bLockWheels);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4324,7 +4340,7 @@ void GameMessages::SendVehicleSetWheelLockState(LWOOBJID objectId, bool bExtraFr
 	bitStream.Write(bExtraFriction);
 	bitStream.Write(bLocked);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4342,7 +4358,7 @@ void GameMessages::SendRacingSetPlayerResetInfo(LWOOBJID objectId, int32_t curre
 	bitStream.Write(respawnPos);
 	bitStream.Write(upcomingPlane);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4356,7 +4372,7 @@ void GameMessages::SendRacingResetPlayerToLastReset(LWOOBJID objectId, LWOOBJID
 
 	bitStream.Write(playerID);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4369,7 +4385,7 @@ void GameMessages::SendVehicleStopBoost(Entity* targetEntity, const SystemAddres
 
 	bitStream.Write(affectPassive);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(targetEntity->GetObjectID());
 }
 
 void GameMessages::SendSetResurrectRestoreValues(Entity* targetEntity, int32_t armorRestore, int32_t healthRestore, int32_t imaginationRestore) {
@@ -4388,7 +4404,7 @@ void GameMessages::SendSetResurrectRestoreValues(Entity* targetEntity, int32_t a
 	bitStream.Write(imaginationRestore != -1);
 	if (imaginationRestore != -1) bitStream.Write(imaginationRestore);
 
-	SEND_PACKET_BROADCAST;
+	SEND_PACKET_OBSERVERS(targetEntity->GetObjectID());
 }
 
 void GameMessages::SendNotifyRacingClient(LWOOBJID objectId, int32_t eventType, int32_t param1, LWOOBJID paramObj, std::u16string paramStr, LWOOBJID singleClient, const SystemAddress& sysAddr) {
@@ -4412,7 +4428,7 @@ void GameMessages::SendNotifyRacingClient(LWOOBJID objectId, int32_t eventType,
 
 	bitStream.Write(singleClient);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4424,7 +4440,7 @@ void GameMessages::SendActivityEnter(LWOOBJID objectId, const SystemAddress& sys
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::ACTIVITY_ENTER);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4436,7 +4452,7 @@ void GameMessages::SendActivityStart(LWOOBJID objectId, const SystemAddress& sys
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::ACTIVITY_START);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4448,7 +4464,7 @@ void GameMessages::SendActivityExit(LWOOBJID objectId, const SystemAddress& sysA
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::ACTIVITY_EXIT);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4463,7 +4479,7 @@ void GameMessages::SendActivityStop(LWOOBJID objectId, bool bExit, bool bUserCan
 	bitStream.Write(bExit);
 	bitStream.Write(bUserCancel);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4475,7 +4491,7 @@ void GameMessages::SendVehicleAddPassiveBoostAction(LWOOBJID objectId, const Sys
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::VEHICLE_ADD_PASSIVE_BOOST_ACTION);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4487,7 +4503,7 @@ void GameMessages::SendVehicleRemovePassiveBoostAction(LWOOBJID objectId, const
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::VEHICLE_REMOVE_PASSIVE_BOOST_ACTION);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4499,7 +4515,7 @@ void GameMessages::SendVehicleNotifyFinishedRace(LWOOBJID objectId, const System
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::VEHICLE_NOTIFY_FINISHED_RACE);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -4537,7 +4553,7 @@ void GameMessages::SendAddBuff(LWOOBJID& objectID, const LWOOBJID& casterID, uin
 	bitStream.Write(msDuration != 0);
 	if (msDuration != 0) bitStream.Write(msDuration);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectID);
 	SEND_PACKET;
 }
 
@@ -4644,7 +4660,7 @@ void GameMessages::SendShowActivityCountdown(LWOOBJID objectId, bool bPlayAdditi
 
 	bitStream.Write(stateToPlaySoundOn);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -6075,7 +6091,7 @@ void GameMessages::SendActivateBubbleBuffFromServer(LWOOBJID objectId, const Sys
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::ACTIVATE_BUBBLE_BUFF_FROM_SERVER);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -6086,7 +6102,7 @@ void GameMessages::SendDeactivateBubbleBuffFromServer(LWOOBJID objectId, const S
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::DEACTIVATE_BUBBLE_BUFF_FROM_SERVER);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST;
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId);
 	SEND_PACKET;
 }
 
@@ -6111,7 +6127,7 @@ void GameMessages::SendSetNamebillboardState(const SystemAddress& sysAddr, LWOOB
 	// bitStream.Write(overrideDefault);
 	// bitStream.Write(state);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId)
 	else SEND_PACKET
 }
 
@@ -6122,7 +6138,7 @@ void GameMessages::SendShowBillboardInteractIcon(const SystemAddress& sysAddr, L
 	bitStream.Write(objectId);
 	bitStream.Write(eGameMessageType::SHOW_BILLBOARD_INTERACT_ICON);
 
-	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_BROADCAST
+	if (sysAddr == UNASSIGNED_SYSTEM_ADDRESS) SEND_PACKET_OBSERVERS(objectId)
 	else SEND_PACKET
 }
 
@@ -58,7 +58,7 @@ Item::Item(const LWOOBJID id, const LOT lot, Inventory* inventory, const uint32_
 	this->config = config;
 	this->parent = parent;
 	this->info = &Inventory::FindItemComponent(lot);
-	this->preconditions = new PreconditionExpression(this->info->reqPrecondition);
+	this->preconditions = PreconditionExpression(this->info->reqPrecondition);
 	this->subKey = subKey;
 
 	inventory->AddManagedItem(this);
@@ -93,7 +93,7 @@ Item::Item(
 	this->id = LWOOBJID_EMPTY;
 	this->info = &Inventory::FindItemComponent(lot);
 	this->bound = info->isBOP || bound;
-	this->preconditions = new PreconditionExpression(this->info->reqPrecondition);
+	this->preconditions = PreconditionExpression(this->info->reqPrecondition);
 	this->subKey = subKey;
 
 	LWOOBJID id = ObjectIDManager::GenerateRandomObjectID();
@@ -167,8 +167,8 @@ LWOOBJID Item::GetSubKey() const {
 	return subKey;
 }
 
-PreconditionExpression* Item::GetPreconditionExpression() const {
-	return preconditions;
+const PreconditionExpression* Item::GetPreconditionExpression() const {
+	return &preconditions;
 }
 
 void Item::SetCount(const uint32_t value, const bool silent, const bool disassemble, const bool showFlyingLoot, eLootSourceType lootSourceType) {
@@ -528,8 +528,6 @@ void Item::RemoveFromInventory() {
 }
 
 Item::~Item() {
-	delete preconditions;
-
 	for (auto* value : config) {
 		delete value;
 	}
@@ -178,7 +178,7 @@ public:
 	 * Returns the preconditions that must be met before this item may be used
 	 * @return the preconditions that must be met before this item may be used
 	 */
-	PreconditionExpression* GetPreconditionExpression() const;
+	const PreconditionExpression* GetPreconditionExpression() const;
 
 	/**
 	 * Equips this item into the linked inventory
@@ -282,5 +282,5 @@ private:
 	/**
 	 * A precondition to using this item
 	 */
-	PreconditionExpression* preconditions = nullptr;
+	PreconditionExpression preconditions;
 };
@@ -596,11 +596,19 @@ void Mission::Progress(eMissionTaskType type, int32_t value, LWOOBJID associate,
 void Mission::SetMissionState(const eMissionState state, const bool sendingRewards) {
 	this->m_State = state;
 
+	// Missions that become active again, like repeatable ones, have to be found by progress again
+	if (!IsComplete()) m_MissionComponent->IndexMission(this);
+
 	auto* entity = GetAssociate();
 
 	if (entity == nullptr) {
 		return;
 	}
+
+	// Preconditions can depend on the state of missions
+	auto* character = entity->GetCharacter();
+	if (character) character->ClearPreconditionCache();
+
 	auto* characterComponent = entity->GetComponent<CharacterComponent>();
 	if (!characterComponent) return;
 
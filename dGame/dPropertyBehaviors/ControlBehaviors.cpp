@@ -54,7 +54,8 @@ void ControlBehaviors::RequestUpdatedID(ControlBehaviorContext& context) {
 void ControlBehaviors::SendBehaviorListToClient(const ControlBehaviorContext& context) {
 	if (!context) return;
 
-	AMFArrayValue behaviorsToSerialize;
+	AMFArena arena;
+	AMFArrayValue behaviorsToSerialize{ arena };
 	context.modelComponent->SendBehaviorListToClient(behaviorsToSerialize);
 
 	GameMessages::SendUIMessageServerToSingleClient(context.modelOwner, context.modelOwner->GetSystemAddress(), "UpdateBehaviorList", behaviorsToSerialize);
@@ -66,7 +67,8 @@ void ControlBehaviors::SendBehaviorBlocksToClient(ControlBehaviorContext& contex
 	BehaviorMessageBase behaviorMsg{ context.arguments };
 
 	context.modelComponent->VerifyBehaviors();
-	AMFArrayValue behavior;
+	AMFArena arena;
+	AMFArrayValue behavior{ arena };
 	context.modelComponent->SendBehaviorBlocksToClient(behaviorMsg.GetBehaviorId(), behavior);
 	GameMessages::SendUIMessageServerToSingleClient(context.modelOwner, context.modelOwner->GetSystemAddress(), "UpdateBehaviorBlocks", behavior);
 }
@@ -113,9 +115,12 @@ void ControlBehaviors::ProcessCommand(Entity* const modelEntity, const AMFArrayV
 	} else if (command == "toggleExecutionUpdates") {
 		// TODO
 	} else if (command == "addStrip") {
-		if (BehaviorMessageBase(context.arguments).IsDefaultBehaviorId()) RequestUpdatedID(context);
+		const auto isNewBehavior = BehaviorMessageBase(context.arguments).IsDefaultBehaviorId();
 
 		context.modelComponent->HandleControlBehaviorsMsg<AddStripMessage>(context.arguments);
+
+		// The new ID can be handed out right away, so the behavior has to exist before requesting it
+		if (isNewBehavior) RequestUpdatedID(context);
 	} else if (command == "removeStrip") {
 		context.modelComponent->HandleControlBehaviorsMsg<RemoveStripMessage>(arguments);
 	} else if (command == "mergeStrips") {
@@ -1,43 +1,93 @@
 #include "ObjectIDManager.h"
 
+// C++
+#include <algorithm>
+#include <deque>
+
 // Custom Classes
 #include "MasterPackets.h"
 #include "Database.h"
 #include "Logger.h"
 #include "Game.h"
+#include "dConfig.h"
+#include "GeneralUtils.h"
 
- //! The persistent ID request
-struct PersistentIDRequest {
-	PersistentIDRequest(const uint64_t& requestID, const std::function<void(uint32_t)>& callback) : requestID(requestID), callback(callback) {}
-	uint64_t requestID;
+ //! A block of persistent IDs leased from the master
+struct PersistentIDBlock {
+	uint32_t nextID;
 
-	std::function<void(uint32_t)> callback;
+	uint32_t remaining;
 };
 
 namespace {
-	std::vector<PersistentIDRequest> Requests; //!< All outstanding persistent ID requests
-	uint64_t CurrentRequestID = 0;                  //!< The current request ID
+	std::deque<PersistentIDBlock> Blocks;                            //!< The current block and the prefetched one
+	std::deque<std::function<void(uint32_t)>> WaitingRequests;       //!< Requests waiting for the next block, oldest first
+	bool BlockRequested = false;                                     //!< Whether a block was requested and did not arrive yet
+	uint32_t BlockSize = 0;                                          //!< The number of IDs to lease at once, read from the config
 	uint32_t CurrentObjectID = uint32_t(1152921508165007067);                   //!< The current object ID
 	std::uniform_int_distribution<int> Uni(10000000, INT32_MAX);
+
+	bool TakePersistentID(uint32_t& persistentID) {
+		while (!Blocks.empty() && Blocks.front().remaining == 0) Blocks.pop_front();
+		if (Blocks.empty()) return false;
+
+		auto& block = Blocks.front();
+		persistentID = block.nextID++;
+		block.remaining--;
+		return true;
+	}
+
+	//! Requests the next block once the IDs left drop to a quarter of a block
+	void PrefetchBlock() {
+		if (BlockRequested) return;
+
+		if (BlockSize == 0) {
+			// Clamped to what the master leases at once, a larger block would never refill before running dry
+			const auto configuredSize = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("persistent_id_block_size")).value_or(100);
+			BlockSize = std::clamp<uint32_t>(configuredSize, 1, MasterPackets::MaxPersistentIDBlockSize);
+		}
+
+		uint32_t remaining = 0;
+		for (const auto& block : Blocks) remaining += block.remaining;
+		if (remaining > BlockSize / 4 && WaitingRequests.empty()) return;
+
+		BlockRequested = true;
+		MasterPackets::SendPersistentIDBlockRequest(Game::server, BlockSize);
+	}
 };
 
 //! Requests a persistent ID
 void ObjectIDManager::RequestPersistentID(const std::function<void(uint32_t)> callback) {
-	const auto& request = Requests.emplace_back(++CurrentRequestID, callback);
+	uint32_t persistentID = 0;
+	if (!WaitingRequests.empty() || !TakePersistentID(persistentID)) {
+		WaitingRequests.push_back(callback);
+		PrefetchBlock();
+		return;
+	}
 
-	MasterPackets::SendPersistentIDRequest(Game::server, request.requestID);
+	PrefetchBlock();
+	callback(persistentID);
 }
 
-//! Handles a persistent ID response
-void ObjectIDManager::HandleRequestPersistentIDResponse(const uint64_t requestID, const uint32_t persistentID) {
-	auto it = std::find_if(Requests.begin(), Requests.end(), [requestID](const PersistentIDRequest& request) {
-		return request.requestID == requestID;
-	});
+//! Handles a block of persistent IDs leased from the master
+void ObjectIDManager::HandlePersistentIDBlock(const uint32_t firstID, const uint32_t count) {
+	BlockRequested = false;
+
+	if (count == 0) {
+		LOG("Master leased an empty block of persistent IDs");
+		return;
+	}
+
+	Blocks.push_back({ firstID, count });
 
-	if (it == Requests.end()) return;
+	uint32_t persistentID = 0;
+	while (!WaitingRequests.empty() && TakePersistentID(persistentID)) {
+		const auto callback = std::move(WaitingRequests.front());
+		WaitingRequests.pop_front();
+		callback(persistentID);
+	}
 
-	it->callback(persistentID);
-	Requests.erase(it);
+	PrefetchBlock();
 }
 
 //! Handles cases where we have to get a unique object ID synchronously
@@ -2,7 +2,6 @@
 
 // C++
 #include <functional>
-#include <vector>
 #include <stdint.h>
 
 /*!
@@ -14,17 +13,19 @@
 namespace ObjectIDManager {
 	//! Requests a persistent ID
 	/*!
+	  Persistent IDs are handed out from a block leased from the master. The callback runs right away
+	  while the block has IDs left, otherwise once the next block arrived.
 	  \param callback The callback function
 	 */
 	void RequestPersistentID(const std::function<void(uint32_t)> callback);
 
 
-	//! Handles a persistent ID response
+	//! Handles a block of persistent IDs leased from the master
 	/*!
-	  \param requestID The request ID
-	  \param persistentID The persistent ID
+	  \param firstID The first persistent ID of the block
+	  \param count The number of IDs in the block
 	 */
-	void HandleRequestPersistentIDResponse(const uint64_t requestID, const uint32_t persistentID);
+	void HandlePersistentIDBlock(const uint32_t firstID, const uint32_t count);
 
 	//! Generates an object ID server-sided
 	/*!
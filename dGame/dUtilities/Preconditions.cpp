@@ -16,7 +16,11 @@
 
 std::map<uint32_t, Precondition*> Preconditions::cache = {};
 
+std::unordered_map<std::string, std::vector<PreconditionExpression::Term>> PreconditionExpression::compiled = {};
+
 Precondition::Precondition(const uint32_t condition) {
+	this->id = condition;
+
 	auto query = CDClientDatabase::CreatePreppedStmt(
 		"SELECT type, targetLOT, targetCount FROM Preconditions WHERE id = ?;");
 	query.bind(1, static_cast<int>(condition));
@@ -53,6 +57,46 @@ Precondition::Precondition(const uint32_t condition) {
 
 
 bool Precondition::Check(Entity* player, bool evaluateCosts) const {
+	if (evaluateCosts || !IsCacheable()) {
+		return CheckValues(player, evaluateCosts);
+	}
+
+	auto* character = player->GetCharacter();
+
+	if (character == nullptr) {
+		return CheckValues(player, evaluateCosts);
+	}
+
+	const auto cached = character->GetCachedPrecondition(id);
+
+	if (cached.has_value()) {
+		return cached.value();
+	}
+
+	const auto result = CheckValues(player, evaluateCosts);
+
+	character->CachePrecondition(id, result);
+
+	return result;
+}
+
+
+bool Precondition::IsCacheable() const {
+	switch (type) {
+	case PreconditionType::HasAchievement:
+	case PreconditionType::MissionAvailable:
+	case PreconditionType::OnMission:
+	case PreconditionType::MissionComplete:
+	case PreconditionType::HasFlag:
+	case PreconditionType::HasLevel:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+bool Precondition::CheckValues(Entity* player, bool evaluateCosts) const {
 	if (values.empty()) {
 		return true; // There are very few of these
 	}
@@ -199,113 +243,107 @@ bool Precondition::CheckValue(Entity* player, const uint32_t value, bool evaluat
 
 PreconditionExpression::PreconditionExpression(const std::string& conditions) {
 	if (conditions.empty()) {
-		empty = true;
-
 		return;
 	}
 
-	std::stringstream a;
-	std::stringstream b;
+	this->terms = &Compile(conditions);
+}
 
-	auto bor = false;
 
-	auto done = false;
+const std::vector<PreconditionExpression::Term>& PreconditionExpression::Compile(const std::string& conditions) {
+	const auto& index = compiled.find(conditions);
 
-	for (auto i = 0u; i < conditions.size(); ++i) {
-		if (done) {
-			break;
-		}
+	if (index != compiled.end()) {
+		return index->second;
+	}
 
-		const auto character = conditions[i];
+	std::vector<Term> result;
 
-		switch (character) {
-		case '|':
-			bor = true;
-			b << conditions.substr(i + 1);
-			done = true;
-			break;
-		case ' ':
-		case ')':
-			break;
-		case ',':
-		case '&':
-		case ';':
-		case '(':
-			b << conditions.substr(i + 1);
-			done = true;
-			break;
-		case '0':
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':
-			a << character;
-			break;
-		default:
-			break;
+	// Every term is a condition ID up to the next separator, the rest of the string after the separator is the next term
+	size_t start = 0;
+
+	while (true) {
+		Term term;
+
+		std::string digits;
+
+		auto next = std::string::npos;
+
+		for (auto i = start; i < conditions.size(); ++i) {
+			const auto character = conditions[i];
+
+			if (character == '|' || character == ',' || character == '&' || character == ';' || character == '(') {
+				term.m_or = character == '|';
+				next = i + 1;
+				break;
+			}
+
+			if (character >= '0' && character <= '9') {
+				digits += character;
+			}
 		}
-	}
 
-	this->m_or = bor;
+		if (!digits.empty()) {
+			term.condition = std::stoul(digits);
+		}
 
-	const auto aString = a.str();
+		term.precondition = Preconditions::Get(term.condition);
 
-	if (!aString.empty()) {
-		this->condition = std::stoul(a.str());
-	} else {
-		this->condition = 0;
-	}
+		result.push_back(term);
 
-	const auto bString = b.str();
+		if (next == std::string::npos || next >= conditions.size()) {
+			break;
+		}
 
-	if (!bString.empty()) {
-		this->next = new PreconditionExpression(bString);
-	} else {
-		this->next = nullptr;
+		start = next;
 	}
+
+	return compiled.insert_or_assign(conditions, std::move(result)).first->second;
 }
 
 
 bool PreconditionExpression::Check(Entity* player, bool evaluateCosts) const {
-	if (empty) {
+	if (terms == nullptr || terms->empty()) {
 		return true;
 	}
 
-	const auto a = Preconditions::Check(player, condition, evaluateCosts);
+	return Check(player, 0, evaluateCosts);
+}
+
+
+bool PreconditionExpression::Check(Entity* player, const size_t index, bool evaluateCosts) const {
+	const auto& term = (*terms)[index];
+
+	const auto a = term.precondition->Check(player, evaluateCosts);
 
 	if (!a) {
-		GameMessages::SendNotifyClientFailedPrecondition(player->GetObjectID(), player->GetSystemAddress(), u"", condition);
+		GameMessages::SendNotifyClientFailedPrecondition(player->GetObjectID(), player->GetSystemAddress(), u"", term.condition);
 	}
 
-	const auto b = next == nullptr ? true : next->Check(player, evaluateCosts);
-
-	return m_or ? a || b : a && b;
-}
+	// Every term is checked so the client hears about every failed precondition, the rest of the expression binds tighter
+	const auto b = index + 1 >= terms->size() ? true : Check(player, index + 1, evaluateCosts);
 
-PreconditionExpression::~PreconditionExpression() {
-	delete next;
+	return term.m_or ? a || b : a && b;
 }
 
 
 bool Preconditions::Check(Entity* player, const uint32_t condition, bool evaluateCosts) {
-	Precondition* precondition;
+	return Get(condition)->Check(player, evaluateCosts);
+}
 
+
+const Precondition* Preconditions::Get(const uint32_t condition) {
 	const auto& index = cache.find(condition);
 
 	if (index != cache.end()) {
-		precondition = index->second;
-	} else {
-		precondition = new Precondition(condition);
-
-		cache.insert_or_assign(condition, precondition);
+		return index->second;
 	}
 
-	return precondition->Check(player, evaluateCosts);
+	auto* precondition = new Precondition(condition);
+
+	cache.insert_or_assign(condition, precondition);
+
+	return precondition;
 }
 
 
@@ -1,4 +1,7 @@
 #pragma once
+#include <map>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Entity.h"
@@ -38,8 +41,18 @@ public:
 	bool Check(Entity* player, bool evaluateCosts = false) const;
 
 private:
+	bool CheckValues(Entity* player, bool evaluateCosts) const;
+
 	bool CheckValue(Entity* player, uint32_t value, bool evaluateCosts = false) const;
 
+	/**
+	 * Whether the result only depends on player state that invalidates the cached results of the character when it changes,
+	 * which are flags, missions and the level.
+	 */
+	bool IsCacheable() const;
+
+	uint32_t id;
+
 	PreconditionType type;
 
 	std::vector<uint32_t> values;
@@ -48,23 +61,39 @@ private:
 };
 
 
+/**
+ * A precondition expression like "123|(45,67)".
+ * Expressions are compiled once per distinct string and shared by everything using the same string,
+ * so creating and copying an expression does not allocate.
+ */
 class PreconditionExpression final
 {
 public:
+	// An empty expression, which always passes
+	PreconditionExpression() = default;
+
 	explicit PreconditionExpression(const std::string& conditions);
 
 	bool Check(Entity* player, bool evaluateCosts = false) const;
 
-	~PreconditionExpression();
-
 private:
-	uint32_t condition = 0;
+	struct Term {
+		uint32_t condition = 0;
 
-	bool m_or = false;
+		const Precondition* precondition = nullptr;
 
-	bool empty = false;
+		// Whether this term is or'ed with the rest of the expression instead of and'ed
+		bool m_or = false;
+	};
 
-	PreconditionExpression* next = nullptr;
+	bool Check(Entity* player, size_t index, bool evaluateCosts) const;
+
+	static const std::vector<Term>& Compile(const std::string& conditions);
+
+	const std::vector<Term>* terms = nullptr;
+
+	// Compiled expressions by their string, they live until shutdown
+	static std::unordered_map<std::string, std::vector<Term>> compiled;
 };
 
 class Preconditions final
@@ -72,6 +101,8 @@ class Preconditions final
 public:
 	static bool Check(Entity* player, uint32_t condition, bool evaluateCosts = false);
 
+	static const Precondition* Get(uint32_t condition);
+
 	static PreconditionExpression CreateExpression(const std::string& conditions);
 
 	~Preconditions();
@@ -1218,6 +1218,11 @@ namespace DEVGMCommands {
 			);
 		}
 
+		ChatPackets::SendSystemMessage(
+			sysAddr,
+			u"Queued constructions: " + GeneralUtils::to_u16string(Game::entityManager->GetQueuedConstructions())
+		);
+
 		ChatPackets::SendSystemMessage(
 			sysAddr,
 			u"Peak RSS: " + GeneralUtils::to_u16string(static_cast<float>(static_cast<double>(Metrics::GetPeakRSS()) / 1.024e6)) +
@@ -0,0 +1,418 @@
+#include "Bot.h"
+
+#include <cmath>
+#include <vector>
+
+#include "BitStreamUtils.h"
+#include "dServer.h"
+#include "Game.h"
+#include "GeneralUtils.h"
+#include "Logger.h"
+#include "MessageIdentifiers.h"
+#include "RakNetStatistics.h"
+#include "RakNetworkFactory.h"
+#include "RakPeerInterface.h"
+#include "StartSkill.h"
+#include "eAuthMessageType.h"
+#include "eCharacterCreationResponse.h"
+#include "eClientMessageType.h"
+#include "eConnectionType.h"
+#include "eLoginResponse.h"
+#include "eServerMessageType.h"
+#include "eWorldMessageType.h"
+
+namespace {
+	// The version the game client sends in its handshake
+	constexpr uint32_t clientNetVersion = 171022;
+
+	// Public chat
+	constexpr uint8_t chatChannel = 4;
+
+	// Predefined names are picked at random and may already be taken
+	constexpr uint32_t maxCharacterCreateAttempts = 10;
+}
+
+Bot::Bot(uint32_t index, const Settings& settings) {
+	m_Index = index;
+	m_Settings = settings;
+	m_StartTime = std::chrono::steady_clock::now();
+
+	Connect(m_Settings.authIP, m_Settings.authPort, State::CONNECTING_AUTH);
+}
+
+Bot::~Bot() {
+	Disconnect();
+}
+
+void Bot::Connect(const std::string& ip, uint16_t port, State state) {
+	if (m_Peer) Disconnect();
+
+	m_State = state;
+
+	m_Peer = RakNetworkFactory::GetRakPeerInterface();
+	SocketDescriptor socketDescriptor(0, 0);
+	if (!m_Peer->Startup(1, 10, &socketDescriptor, 1) || !m_Peer->Connect(ip.c_str(), port, "3.25 ND1", 8)) {
+		Fail("Failed to start connecting to " + ip + ":" + std::to_string(port));
+	}
+}
+
+void Bot::Disconnect() {
+	if (!m_Peer) return;
+
+	if (m_State == State::IN_WORLD) UpdateWorldStats();
+
+	m_Peer->Shutdown(100);
+	RakNetworkFactory::DestroyRakPeerInterface(m_Peer);
+	m_Peer = nullptr;
+}
+
+void Bot::Fail(const std::string& error) {
+	LOG("Bot %s failed: %s", m_Settings.username.c_str(), error.c_str());
+	m_Stats.error = error;
+	Disconnect();
+	m_State = State::FAILED;
+}
+
+void Bot::Update(std::chrono::steady_clock::time_point now) {
+	if (!m_Peer) return;
+
+	Packet* packet = nullptr;
+	std::vector<unsigned char> data;
+	while (m_Peer && (packet = m_Peer->Receive())) {
+		// Handling a packet may connect to the next server or fail, both destroy the peer the packet belongs to.
+		// So the packet is copied out and deallocated before it is handled.
+		Packet copy = *packet;
+		data.assign(packet->data, packet->data + packet->length);
+		m_Peer->DeallocatePacket(packet);
+		copy.data = data.data();
+
+		HandlePacket(&copy);
+		if (m_State == State::FAILED) return;
+	}
+
+	if (m_State != State::IN_WORLD || !m_Peer) return;
+
+	if (now - m_LastPositionUpdate >= m_Settings.positionUpdateInterval) SendPositionUpdate(now);
+
+	if (m_Settings.skillID != 0 && now - m_LastSkill >= m_Settings.skillInterval) SendSkill();
+
+	if (m_Settings.chatInterval.count() > 0 && now - m_LastChatMessage >= m_Settings.chatInterval) SendChatMessage();
+
+	if (now - m_LastPingSample >= std::chrono::seconds(1)) {
+		m_LastPingSample = now;
+		const auto ping = m_Peer->GetLastPing(m_ServerAddress);
+		if (ping >= 0) m_Stats.pings.push_back(ping);
+	}
+}
+
+void Bot::HandlePacket(Packet* packet) {
+	switch (packet->data[0]) {
+	case ID_CONNECTION_REQUEST_ACCEPTED:
+		m_ServerAddress = packet->systemAddress;
+		SendHandshake();
+		return;
+	case ID_CONNECTION_ATTEMPT_FAILED:
+	case ID_NO_FREE_INCOMING_CONNECTIONS:
+	case ID_INVALID_PASSWORD:
+		Fail("Could not connect to " + std::string(packet->systemAddress.ToString()));
+		return;
+	case ID_DISCONNECTION_NOTIFICATION:
+	case ID_CONNECTION_LOST:
+		Fail("Lost the connection to " + std::string(packet->systemAddress.ToString()));
+		return;
+	case ID_USER_PACKET_ENUM:
+		break;
+	default:
+		return;
+	}
+
+	if (packet->length < 4) return;
+
+	const auto connectionType = static_cast<eConnectionType>(packet->data[1]);
+	if (connectionType == eConnectionType::SERVER) {
+		if (static_cast<eServerMessageType>(packet->data[3]) != eServerMessageType::VERSION_CONFIRM) return;
+
+		if (m_State == State::CONNECTING_AUTH) {
+			m_State = State::LOGGING_IN;
+			SendLoginRequest();
+		} else if (m_State == State::CONNECTING_CHARACTER_SELECT) {
+			m_State = State::SELECTING_CHARACTER;
+			SendValidation();
+		} else if (m_State == State::CONNECTING_WORLD) {
+			m_State = State::LOADING_WORLD;
+			SendValidation();
+		}
+		return;
+	}
+
+	if (connectionType != eConnectionType::CLIENT) return;
+
+	if (m_State == State::IN_WORLD) m_Stats.packetsReceived++;
+
+	CINSTREAM_SKIP_HEADER;
+	switch (static_cast<eClientMessageType>(packet->data[3])) {
+	case eClientMessageType::LOGIN_RESPONSE: {
+		eLoginResponse response;
+		inStream.Read(response);
+		if (response != eLoginResponse::SUCCESS) {
+			Fail("Login was refused with response " + std::to_string(static_cast<uint32_t>(response)));
+			return;
+		}
+
+		for (uint32_t i = 0; i < 8; i++) {
+			LUString event;
+			inStream.Read(event);
+		}
+		inStream.IgnoreBytes(3 * sizeof(uint16_t));
+
+		LUWString sessionKey;
+		inStream.Read(sessionKey);
+		m_SessionKey = sessionKey.GetAsString();
+
+		LUString worldIP;
+		inStream.Read(worldIP);
+		LUString chatIP;
+		inStream.Read(chatIP);
+		uint16_t worldPort = 0;
+		inStream.Read(worldPort);
+
+		Connect(worldIP.string, worldPort, State::CONNECTING_CHARACTER_SELECT);
+		break;
+	}
+	case eClientMessageType::CHARACTER_LIST_RESPONSE: {
+		uint8_t characterCount = 0;
+		inStream.Read(characterCount);
+		inStream.IgnoreBytes(1);
+
+		if (characterCount == 0) {
+			SendCharacterCreate();
+			return;
+		}
+
+		inStream.Read(m_CharacterID);
+		SendCharacterLogin();
+		break;
+	}
+	case eClientMessageType::CHARACTER_CREATE_RESPONSE: {
+		eCharacterCreationResponse response;
+		inStream.Read(response);
+		if (response == eCharacterCreationResponse::SUCCESS) return; // The server sends the character list next
+
+		if (response != eCharacterCreationResponse::PREDEFINED_NAME_IN_USE || ++m_CharacterCreateAttempts >= maxCharacterCreateAttempts) {
+			Fail("Character creation was refused with response " + std::to_string(static_cast<uint32_t>(response)));
+			return;
+		}
+
+		SendCharacterCreate();
+		break;
+	}
+	case eClientMessageType::TRANSFER_TO_WORLD: {
+		LUString worldIP;
+		inStream.Read(worldIP);
+		uint16_t worldPort = 0;
+		inStream.Read(worldPort);
+
+		Connect(worldIP.string, worldPort, State::CONNECTING_WORLD);
+		break;
+	}
+	case eClientMessageType::LOAD_STATIC_ZONE: {
+		uint16_t zoneID = 0;
+		inStream.Read(zoneID);
+		m_ZoneID = zoneID;
+		inStream.IgnoreBytes(sizeof(uint16_t) + sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint16_t));
+		inStream.Read(m_SpawnPosition.x);
+		inStream.Read(m_SpawnPosition.y);
+		inStream.Read(m_SpawnPosition.z);
+
+		SendLevelLoadComplete();
+		break;
+	}
+	case eClientMessageType::CREATE_CHARACTER: {
+		if (m_State != State::LOADING_WORLD) return;
+
+		const auto now = std::chrono::steady_clock::now();
+		m_State = State::IN_WORLD;
+		m_WorldEnterTime = now;
+		m_LastPositionUpdate = now;
+		m_LastChatMessage = now;
+		m_LastSkill = now;
+		m_LastPingSample = now;
+		m_Stats.loginTime = std::chrono::duration<float>(now - m_StartTime).count();
+
+		// Only the time in the world counts towards the bandwidth
+		auto* statistics = m_Peer->GetStatistics(m_ServerAddress);
+		if (statistics) {
+			m_BytesSentOnEnter = BITS_TO_BYTES(statistics->totalBitsSent);
+			m_BytesReceivedOnEnter = BITS_TO_BYTES(statistics->bitsReceived);
+		}
+
+		LOG_DEBUG("Bot %s entered zone %i after %.2fs", m_Settings.username.c_str(), m_ZoneID, m_Stats.loginTime);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+void Bot::SendHandshake() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::SERVER, eServerMessageType::VERSION_CONFIRM);
+	bitStream.Write<uint32_t>(clientNetVersion);
+	bitStream.Write<uint32_t>(0x93);
+	bitStream.Write(ServiceId::Client);
+	bitStream.Write<uint32_t>(m_Index);
+	bitStream.Write<uint16_t>(m_Peer->GetInternalID().port);
+	for (uint32_t i = 0; i < 33; i++) bitStream.Write<uint8_t>(0);
+	Send(bitStream);
+}
+
+void Bot::SendLoginRequest() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::AUTH, eAuthMessageType::LOGIN_REQUEST);
+	bitStream.Write(LUWString(m_Settings.username));
+	bitStream.Write(LUWString(m_Settings.password, 41));
+	bitStream.Write<uint16_t>(0x0409); // en_US
+	bitStream.Write<uint8_t>(1); // Windows
+	bitStream.Write(LUWString("", 256)); // Memory stats
+	bitStream.Write(LUWString("LoadBot", 128)); // Video card
+	bitStream.Write<uint32_t>(1); // Processor count
+	bitStream.Write<uint32_t>(0); // Processor type
+	bitStream.Write<uint16_t>(0); // Processor level
+	bitStream.Write<uint16_t>(0); // Processor revision
+	bitStream.Write<uint32_t>(148); // OS version info size
+	bitStream.Write<uint32_t>(10); // Major version
+	bitStream.Write<uint32_t>(0); // Minor version
+	bitStream.Write<uint32_t>(0); // Build number
+	bitStream.Write<uint32_t>(2); // Platform ID
+	Send(bitStream);
+}
+
+void Bot::SendValidation() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::VALIDATION);
+	bitStream.Write(LUWString(m_Settings.username));
+	bitStream.Write(LUWString(m_SessionKey));
+	bitStream.Write(LUString("", 32)); // The bots don't have a client database to checksum
+	Send(bitStream);
+}
+
+void Bot::SendCharacterCreate() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::CHARACTER_CREATE_REQUEST);
+	bitStream.Write(LUWString("")); // No custom name, use the predefined one
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 100));
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 100));
+	bitStream.Write<uint32_t>(GeneralUtils::GenerateRandomNumber<uint32_t>(0, 100));
+	for (uint32_t i = 0; i < 9; i++) bitStream.Write<uint8_t>(0);
+	bitStream.Write<uint32_t>(0); // Shirt color
+	bitStream.Write<uint32_t>(0); // Shirt style
+	bitStream.Write<uint32_t>(0); // Pants color
+	bitStream.Write<uint32_t>(0); // Hair style
+	bitStream.Write<uint32_t>(0); // Hair color
+	bitStream.Write<uint32_t>(0); // Left hand
+	bitStream.Write<uint32_t>(0); // Right hand
+	bitStream.Write<uint32_t>(0); // Eyebrows
+	bitStream.Write<uint32_t>(0); // Eyes
+	bitStream.Write<uint32_t>(0); // Mouth
+	Send(bitStream);
+}
+
+void Bot::SendCharacterLogin() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::LOGIN_REQUEST);
+	bitStream.Write(m_CharacterID);
+	Send(bitStream);
+}
+
+void Bot::SendLevelLoadComplete() {
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::LEVEL_LOAD_COMPLETE);
+	bitStream.Write<uint16_t>(m_ZoneID);
+	bitStream.Write<uint16_t>(0);
+	bitStream.Write<uint32_t>(0);
+	Send(bitStream);
+}
+
+void Bot::SendPositionUpdate(std::chrono::steady_clock::time_point now) {
+	m_LastPositionUpdate = now;
+
+	// Walk in a circle, every bot starts at a different point of it
+	const auto time = std::chrono::duration<float>(now - m_WorldEnterTime).count();
+	const auto angle = time * m_Settings.walkSpeed / m_Settings.walkRadius + m_Index;
+	const NiPoint3 position(
+		m_SpawnPosition.x + std::cos(angle) * m_Settings.walkRadius,
+		m_SpawnPosition.y,
+		m_SpawnPosition.z + std::sin(angle) * m_Settings.walkRadius);
+	const NiPoint3 velocity(-std::sin(angle) * m_Settings.walkSpeed, 0.0f, std::cos(angle) * m_Settings.walkSpeed);
+
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::POSITION_UPDATE);
+	bitStream.Write(position.x);
+	bitStream.Write(position.y);
+	bitStream.Write(position.z);
+
+	// Face the direction of walking
+	const auto yaw = -angle / 2.0f;
+	bitStream.Write(0.0f);
+	bitStream.Write(std::sin(yaw));
+	bitStream.Write(0.0f);
+	bitStream.Write(std::cos(yaw));
+
+	bitStream.Write(true); // On ground
+	bitStream.Write(false); // On rail
+	bitStream.Write(true);
+	bitStream.Write(velocity.x);
+	bitStream.Write(velocity.y);
+	bitStream.Write(velocity.z);
+	bitStream.Write(false); // Angular velocity
+	bitStream.Write(false); // Local space info
+	bitStream.Write(false); // Remote input info
+	Send(bitStream);
+}
+
+void Bot::SendSkill() {
+	m_LastSkill = std::chrono::steady_clock::now();
+
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::GAME_MSG);
+	bitStream.Write(m_CharacterID);
+
+	StartSkill startSkill;
+	startSkill.optionalOriginatorID = m_CharacterID;
+	startSkill.skillID = m_Settings.skillID;
+	startSkill.uiSkillHandle = ++m_SkillHandle;
+	startSkill.Serialize(bitStream);
+	Send(bitStream);
+}
+
+void Bot::SendChatMessage() {
+	m_LastChatMessage = std::chrono::steady_clock::now();
+
+	const std::u16string message = u"hello";
+
+	CBITSTREAM;
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::WORLD, eWorldMessageType::GENERAL_CHAT_MESSAGE);
+	bitStream.Write<uint8_t>(chatChannel);
+	bitStream.Write<uint16_t>(0);
+	bitStream.Write<uint32_t>(message.size() + 1);
+	for (const auto character : message) bitStream.Write<uint16_t>(character);
+	bitStream.Write<uint16_t>(0);
+	Send(bitStream);
+}
+
+void Bot::Send(RakNet::BitStream& bitStream) {
+	if (!m_Peer) return;
+
+	if (m_State == State::IN_WORLD) m_Stats.packetsSent++;
+	m_Peer->Send(&bitStream, SYSTEM_PRIORITY, RELIABLE_ORDERED, 0, m_ServerAddress, false);
+}
+
+void Bot::UpdateWorldStats() {
+	m_Stats.worldTime = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_WorldEnterTime).count();
+
+	auto* statistics = m_Peer->GetStatistics(m_ServerAddress);
+	if (!statistics) return;
+
+	m_Stats.bytesSent = BITS_TO_BYTES(statistics->totalBitsSent) - m_BytesSentOnEnter;
+	m_Stats.bytesReceived = BITS_TO_BYTES(statistics->bitsReceived) - m_BytesReceivedOnEnter;
+}
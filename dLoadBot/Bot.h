@@ -0,0 +1,124 @@
+#ifndef __BOT__H__
+#define __BOT__H__
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "dCommonVars.h"
+#include "NiPoint3.h"
+#include "RakNetTypes.h"
+
+class RakPeerInterface;
+
+/**
+ * A headless client that logs into the servers like the game client does and then plays a scripted loop:
+ * it walks in a circle around its spawn point, casts a skill and chats in set intervals.
+ * Everything runs on the thread calling Update, the bot only talks to one server at a time.
+ */
+class Bot {
+public:
+	struct Settings {
+		std::string authIP = "127.0.0.1";
+		uint16_t authPort = 1001;
+		std::string username;
+		std::string password;
+
+		// Time between position updates, the game client sends about ten a second while moving
+		std::chrono::milliseconds positionUpdateInterval{ 100 };
+		std::chrono::milliseconds chatInterval{ 30000 };
+		std::chrono::milliseconds skillInterval{ 2000 };
+		// The skill cast on the interval, 0 does not cast skills
+		uint32_t skillID = 0;
+
+		// Radius and speed of the circle the bot walks around its spawn point
+		float walkRadius = 10.0f;
+		float walkSpeed = 5.0f;
+	};
+
+	enum class State : uint8_t {
+		CONNECTING_AUTH,
+		LOGGING_IN,
+		CONNECTING_CHARACTER_SELECT,
+		SELECTING_CHARACTER,
+		CONNECTING_WORLD,
+		LOADING_WORLD,
+		IN_WORLD,
+		FAILED,
+	};
+
+	struct Stats {
+		// Seconds from starting to connect to the auth server until the world sent the character
+		float loginTime = 0.0f;
+		// Seconds spent in the world
+		float worldTime = 0.0f;
+		uint64_t bytesSent = 0;
+		uint64_t bytesReceived = 0;
+		uint32_t packetsSent = 0;
+		uint32_t packetsReceived = 0;
+		// Round trip times to the world server in milliseconds, sampled once a second
+		std::vector<int32_t> pings;
+		std::string error;
+	};
+
+	Bot(uint32_t index, const Settings& settings);
+	~Bot();
+
+	Bot(const Bot&) = delete;
+	Bot& operator=(const Bot&) = delete;
+
+	// Handles every packet the bot received and sends whatever is due
+	void Update(std::chrono::steady_clock::time_point now);
+
+	void Disconnect();
+
+	State GetState() const { return m_State; }
+
+	const Stats& GetStats() const { return m_Stats; }
+
+private:
+	void Connect(const std::string& ip, uint16_t port, State state);
+	void Fail(const std::string& error);
+	void HandlePacket(Packet* packet);
+
+	void SendHandshake();
+	void SendLoginRequest();
+	void SendValidation();
+	void SendCharacterCreate();
+	void SendCharacterLogin();
+	void SendLevelLoadComplete();
+	void SendPositionUpdate(std::chrono::steady_clock::time_point now);
+	void SendSkill();
+	void SendChatMessage();
+	void Send(RakNet::BitStream& bitStream);
+
+	void UpdateWorldStats();
+
+	uint32_t m_Index = 0;
+	Settings m_Settings;
+	State m_State = State::CONNECTING_AUTH;
+	Stats m_Stats;
+
+	RakPeerInterface* m_Peer = nullptr;
+	SystemAddress m_ServerAddress;
+
+	std::string m_SessionKey;
+	LWOOBJID m_CharacterID = LWOOBJID_EMPTY;
+	uint32_t m_CharacterCreateAttempts = 0;
+	LWOMAPID m_ZoneID = 0;
+	NiPoint3 m_SpawnPosition;
+
+	std::chrono::steady_clock::time_point m_StartTime;
+	std::chrono::steady_clock::time_point m_WorldEnterTime;
+	std::chrono::steady_clock::time_point m_LastPositionUpdate;
+	std::chrono::steady_clock::time_point m_LastChatMessage;
+	std::chrono::steady_clock::time_point m_LastSkill;
+	std::chrono::steady_clock::time_point m_LastPingSample;
+	uint32_t m_SkillHandle = 0;
+
+	uint64_t m_BytesSentOnEnter = 0;
+	uint64_t m_BytesReceivedOnEnter = 0;
+};
+
+#endif  //!__BOT__H__
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <bcrypt/BCrypt.hpp>
+
+//DLU Includes:
+#include "dCommonVars.h"
+#include "dConfig.h"
+#include "dServer.h"
+#include "BinaryPathFinder.h"
+#include "Database.h"
+#include "Diagnostics.h"
+#include "Game.h"
+#include "GeneralUtils.h"
+#include "Logger.h"
+#include "Server.h"
+
+#include "Bot.h"
+
+namespace Game {
+	Logger* logger = nullptr;
+	dServer* server = nullptr;
+	dConfig* config = nullptr;
+	Game::signal_t lastSignal = 0;
+	std::mt19937 randomEngine;
+}
+
+namespace {
+	template<typename T>
+	T GetConfig(const std::string& key, const T defaultValue) {
+		return GeneralUtils::TryParse<T>(Game::config->GetValue(key)).value_or(defaultValue);
+	}
+
+	// Creates the accounts of the bots that don't exist yet, all with the same password
+	bool CreateAccounts(const std::string& prefix, const uint32_t count, const std::string& password) {
+		try {
+			Database::Connect();
+		} catch (std::exception& ex) {
+			LOG("Failed to connect to the database to create the bot accounts: %s", ex.what());
+			return false;
+		}
+
+		char salt[BCRYPT_HASHSIZE];
+		char hash[BCRYPT_HASHSIZE];
+		if (::bcrypt_gensalt(12, salt) != 0 || ::bcrypt_hashpw(password.c_str(), salt, hash) != 0) {
+			LOG("Failed to hash the bot password");
+			return false;
+		}
+
+		uint32_t created = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			const auto username = prefix + std::to_string(i);
+			if (Database::Get()->GetAccountInfo(username)) continue;
+
+			Database::Get()->InsertNewAccount(username, std::string(hash, BCRYPT_HASHSIZE));
+			created++;
+		}
+
+		LOG("Created %u bot accounts", created);
+		Database::Destroy("LoadBot");
+		return true;
+	}
+
+	template<typename T>
+	T Percentile(std::vector<T> values, const float percentile) {
+		if (values.empty()) return T{};
+
+		const auto index = std::min<size_t>(static_cast<size_t>(percentile * values.size()), values.size() - 1);
+		std::nth_element(values.begin(), values.begin() + index, values.end());
+		return values[index];
+	}
+
+	template<typename T>
+	void WritePercentiles(std::ostream& out, const std::string& name, const std::vector<T>& values) {
+		out << "\"" << name << "\":{"
+			<< "\"p50\":" << Percentile(values, 0.5f)
+			<< ",\"p95\":" << Percentile(values, 0.95f)
+			<< ",\"p99\":" << Percentile(values, 0.99f)
+			<< ",\"max\":" << Percentile(values, 1.0f)
+			<< "}";
+	}
+
+	// Writes the results of the run as a single JSON object
+	void WriteReport(std::ostream& out, const std::vector<std::unique_ptr<Bot>>& bots, const float duration) {
+		uint32_t inWorld = 0;
+		std::vector<float> loginTimes;
+		std::vector<int32_t> pings;
+		std::vector<float> sentPerSecond;
+		std::vector<float> receivedPerSecond;
+		std::map<std::string, uint32_t> errors;
+
+		for (const auto& bot : bots) {
+			const auto& stats = bot->GetStats();
+			if (!stats.error.empty()) errors[stats.error]++;
+			if (stats.worldTime <= 0.0f) continue;
+
+			inWorld++;
+			loginTimes.push_back(stats.loginTime);
+			pings.insert(pings.end(), stats.pings.begin(), stats.pings.end());
+			sentPerSecond.push_back(stats.bytesSent / stats.worldTime);
+			receivedPerSecond.push_back(stats.bytesReceived / stats.worldTime);
+		}
+
+		out << "{\"bots\":" << bots.size()
+			<< ",\"reached_world\":" << inWorld
+			<< ",\"duration\":" << duration << ",";
+		WritePercentiles(out, "login_seconds", loginTimes);
+		out << ",";
+		WritePercentiles(out, "ping_ms", pings);
+		out << ",";
+		WritePercentiles(out, "sent_bytes_per_second", sentPerSecond);
+		out << ",";
+		WritePercentiles(out, "received_bytes_per_second", receivedPerSecond);
+		out << ",\"errors\":{";
+		bool first = true;
+		for (const auto& [error, count] : errors) {
+			if (!first) out << ",";
+			first = false;
+			out << "\"" << error << "\":" << count;
+		}
+		out << "}}" << std::endl;
+	}
+}
+
+int main(int argc, char** argv) {
+	Diagnostics::SetProcessName("LoadBot");
+	Diagnostics::SetProcessFileName(argv[0]);
+	Diagnostics::Initialize();
+
+	std::signal(SIGINT, Game::OnSignal);
+	std::signal(SIGTERM, Game::OnSignal);
+
+	Game::config = new dConfig("loadbotconfig.ini");
+
+	Server::SetupLogger("LoadBot");
+	if (!Game::logger) return EXIT_FAILURE;
+
+	Game::randomEngine = std::mt19937(time(0));
+
+	const auto botCount = GetConfig<uint32_t>("bot_count", 10);
+	const auto accountPrefix = Game::config->GetValue("account_prefix").empty() ? "loadbot" : Game::config->GetValue("account_prefix");
+	const auto password = Game::config->GetValue("account_password");
+
+	if (Game::config->GetValue("create_accounts") == "1" && !CreateAccounts(accountPrefix, botCount, password)) {
+		return EXIT_FAILURE;
+	}
+
+	Bot::Settings settings;
+	settings.authIP = Game::config->GetValue("auth_ip").empty() ? "127.0.0.1" : Game::config->GetValue("auth_ip");
+	settings.authPort = GetConfig<uint16_t>("auth_port", 1001);
+	settings.password = password;
+	settings.positionUpdateInterval = std::chrono::milliseconds(GetConfig<uint32_t>("position_update_interval", 100));
+	settings.chatInterval = std::chrono::milliseconds(GetConfig<uint32_t>("chat_interval", 30000));
+	settings.skillInterval = std::chrono::milliseconds(GetConfig<uint32_t>("skill_interval", 2000));
+	settings.skillID = GetConfig<uint32_t>("skill_id", 0);
+	settings.walkRadius = GetConfig<float>("walk_radius", 10.0f);
+
+	const auto spawnInterval = std::chrono::milliseconds(GetConfig<uint32_t>("bot_spawn_interval", 200));
+	const auto duration = std::chrono::seconds(GetConfig<uint32_t>("duration", 120));
+
+	LOG("Starting %u bots against %s:%u for %llis", botCount, settings.authIP.c_str(), settings.authPort, duration.count());
+
+	std::vector<std::unique_ptr<Bot>> bots;
+	bots.reserve(botCount);
+
+	const auto start = std::chrono::steady_clock::now();
+	auto nextSpawn = start;
+	auto t = start;
+	while (!Game::ShouldShutdown()) {
+		const auto now = std::chrono::steady_clock::now();
+		if (now - start >= duration) break;
+
+		// Ramp the bots up instead of logging all of them in at once
+		if (bots.size() < botCount && now >= nextSpawn) {
+			settings.username = accountPrefix + std::to_string(bots.size());
+			bots.push_back(std::make_unique<Bot>(bots.size(), settings));
+			nextSpawn += spawnInterval;
+		}
+
+		for (auto& bot : bots) bot->Update(now);
+
+		t += std::chrono::milliseconds(highFrameDelta);
+		std::this_thread::sleep_until(t);
+	}
+
+	for (auto& bot : bots) bot->Disconnect();
+
+	const auto elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+
+	std::stringstream report;
+	WriteReport(report, bots, elapsed);
+	std::cout << report.str();
+
+	const auto outputFile = Game::config->GetValue("output_file");
+	if (!outputFile.empty()) {
+		std::ofstream file(BinaryPathFinder::GetBinaryDir() / outputFile);
+		file << report.str();
+	}
+
+	LOG("Finished, %s", report.str().c_str());
+	Game::logger->Flush();
+	delete Game::logger;
+	delete Game::config;
+
+	return EXIT_SUCCESS;
+}
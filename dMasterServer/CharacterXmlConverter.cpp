@@ -0,0 +1,69 @@
+#include "CharacterXmlConverter.h"
+
+#include "tinyxml2.h"
+
+#include "CharacterSections.h"
+#include "Database.h"
+#include "DatabaseTransaction.h"
+#include "Game.h"
+#include "Logger.h"
+
+bool CharacterXmlConverter::Export(const uint32_t charId) {
+	const auto storedSections = Database::Get()->GetCharacterSections(charId);
+	if (storedSections.empty()) {
+		LOG("Character %i has no sections, its charxml is already up to date", charId);
+		return false;
+	}
+
+	CharacterSections::SectionMap sections;
+	for (const auto& section : storedSections) {
+		auto sectionXml = CharacterSections::Decode(section.data);
+		if (!sectionXml) {
+			LOG("Failed to decode section %s of character %i, not exporting!", section.name.c_str(), charId);
+			return false;
+		}
+
+		sections[section.name] = std::move(*sectionXml);
+	}
+
+	Database::Get()->UpdateCharacterXml(charId, CharacterSections::Join(sections));
+	LOG("Exported %i sections of character %i to its charxml", sections.size(), charId);
+	return true;
+}
+
+bool CharacterXmlConverter::Import(const uint32_t charId) {
+	const auto xml = Database::Get()->GetCharacterXml(charId);
+
+	tinyxml2::XMLDocument doc;
+	if (xml.empty() || doc.Parse(xml.c_str(), xml.size()) != tinyxml2::XML_SUCCESS) {
+		LOG("Character %i has no valid charxml, not importing!", charId);
+		return false;
+	}
+
+	const auto sections = CharacterSections::Split(doc);
+	if (sections.empty()) {
+		LOG("The charxml of character %i has no obj element, not importing!", charId);
+		return false;
+	}
+
+	DatabaseTransaction transaction(*Database::Get());
+
+	for (const auto& section : Database::Get()->GetCharacterSections(charId)) {
+		if (!sections.contains(section.name)) Database::Get()->DeleteCharacterSection(charId, section.name);
+	}
+
+	for (const auto& [name, sectionXml] : sections) {
+		const auto encoded = CharacterSections::Encode(sectionXml);
+		if (!encoded) {
+			LOG("Failed to encode section %s of character %i, not importing!", name.c_str(), charId);
+			return false;
+		}
+
+		Database::Get()->UpsertCharacterSection(charId, name, *encoded);
+	}
+
+	transaction.Commit();
+
+	LOG("Imported the charxml of character %i into %i sections", charId, sections.size());
+	return true;
+}
@@ -0,0 +1,21 @@
+#ifndef __CHARACTERXMLCONVERTER__H__
+#define __CHARACTERXMLCONVERTER__H__
+
+#include <cstdint>
+
+/**
+ * Converts a character between its stored sections and the charxml table.
+ *
+ * Saves only write the sections of a character, so the charxml of a character saved in sections goes stale.
+ * Exporting writes the current sections back to charxml for tools that read it, importing replaces the sections
+ * with whatever is in charxml, for example after a tool edited it.
+ */
+namespace CharacterXmlConverter {
+	// Joins the sections of the character and writes them to its charxml. Returns false if there was nothing to export.
+	bool Export(const uint32_t charId);
+
+	// Splits the charxml of the character and replaces its sections with it. Returns false if the charxml is not valid.
+	bool Import(const uint32_t charId);
+};
+
+#endif  //!__CHARACTERXMLCONVERTER__H__
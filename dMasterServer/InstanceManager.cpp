@@ -154,7 +154,7 @@ void InstanceManager::ReadyInstance(Instance* instance) {
 	for (const auto& request : pending) {
 		const auto& zoneId = instance->GetZoneID();
 
-		LOG("Responding to pending request %llu -> %i (%i)", request, zoneId.GetMapID(), zoneId.GetCloneID());
+		LOG("Responding to pending request %llu -> %i (%i)", request.id, zoneId.GetMapID(), zoneId.GetCloneID());
 
 		MasterPackets::SendZoneTransferResponse(
 			Game::server,
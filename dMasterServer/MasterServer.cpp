@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <ctime>
@@ -41,6 +42,7 @@
 #include "Start.h"
 #include "Server.h"
 #include "CDZoneTableTable.h"
+#include "CharacterXmlConverter.h"
 #include "eGameMasterLevel.h"
 
 namespace Game {
@@ -81,6 +83,8 @@ int main(int argc, char** argv) {
 	Game::config = new dConfig("masterconfig.ini");
 
 	//Create all the objects we need to run our service:
+	// Writes out everything logged before any return from main, including the early ones on failure
+	const Server::LoggerGuard loggerGuard;
 	Server::SetupLogger("MasterServer");
 	if (!Game::logger) return EXIT_FAILURE;
 
@@ -284,6 +288,21 @@ int main(int argc, char** argv) {
 		return EXIT_SUCCESS;
 	}
 
+	//If the first command line argument is --export-charxml or --import-charxml then convert the
+	//character with the id given as the second argument between its sections and its charxml.
+	if (argc > 1 &&
+		(strcmp(argv[1], "--export-charxml") == 0 || strcmp(argv[1], "--import-charxml") == 0)) {
+		const auto charId = argc > 2 ? GeneralUtils::TryParse<uint32_t>(argv[2]) : std::nullopt;
+		if (!charId) {
+			LOG("Usage: %s <character id>", argv[1]);
+			return EXIT_FAILURE;
+		}
+
+		const auto converted = strcmp(argv[1], "--export-charxml") == 0 ?
+			CharacterXmlConverter::Export(*charId) : CharacterXmlConverter::Import(*charId);
+		return converted ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
 	Game::randomEngine = std::mt19937(time(0));
 	uint32_t maxClients = 999;
 	uint32_t ourPort = 2000;
@@ -329,7 +348,7 @@ int main(int argc, char** argv) {
 		StartAuthServer();
 	}
 
-	auto t = std::chrono::high_resolution_clock::now();
+	auto t = std::chrono::steady_clock::now();
 	Packet* packet = nullptr;
 	constexpr uint32_t logFlushTime = 15 * masterFramerate;
 	constexpr uint32_t sqlPingTime = 10 * 60 * masterFramerate;
@@ -341,85 +360,86 @@ int main(int argc, char** argv) {
 
 	Game::logger->Flush();
 	while (!Game::ShouldShutdown()) {
-		//In world we'd update our other systems here.
-
-		//Check for packets here:
-		packet = Game::server->Receive();
-		if (packet) {
+		//Check for packets here, handling everything that arrived since we last woke up:
+		while ((packet = Game::server->Receive())) {
 			HandlePacket(packet);
 			Game::server->DeallocatePacket(packet);
-			packet = nullptr;
 		}
 
-		//Push our log every 15s:
-		if (framesSinceLastFlush >= logFlushTime) {
-			Game::logger->Flush();
-			framesSinceLastFlush = 0;
-		} else
-			framesSinceLastFlush++;
-
-		//Every 10 min we ping our sql server to keep it alive hopefully:
-		if (framesSinceLastSQLPing >= sqlPingTime) {
-			//Find out the master's IP for absolutely no reason:
-			std::string masterIP;
-			uint32_t masterPort;
-			auto masterInfo = Database::Get()->GetMasterInfo();
-			if (masterInfo) {
-				masterIP = masterInfo->ip;
-				masterPort = masterInfo->port;
-			}
+		//Everything else still runs once per frame:
+		if (std::chrono::steady_clock::now() >= t) {
+			t += std::chrono::milliseconds(masterFrameDelta);
 
-			framesSinceLastSQLPing = 0;
-		} else
-			framesSinceLastSQLPing++;
+			//Push our log every 15s:
+			if (framesSinceLastFlush >= logFlushTime) {
+				Game::logger->Flush();
+				framesSinceLastFlush = 0;
+			} else
+				framesSinceLastFlush++;
+
+			//Every 10 min we ping our sql server to keep it alive hopefully:
+			if (framesSinceLastSQLPing >= sqlPingTime) {
+				//Find out the master's IP for absolutely no reason:
+				std::string masterIP;
+				uint32_t masterPort;
+				auto masterInfo = Database::Get()->GetMasterInfo();
+				if (masterInfo) {
+					masterIP = masterInfo->ip;
+					masterPort = masterInfo->port;
+				}
 
-		//10m shutdown for universe kill command
-		if (Game::universeShutdownRequested) {
-			if (framesSinceKillUniverseCommand >= shutdownUniverseTime) {
-				//Break main loop and exit
-				Game::lastSignal = -1;
+				framesSinceLastSQLPing = 0;
 			} else
-				framesSinceKillUniverseCommand++;
-		}
+				framesSinceLastSQLPing++;
+
+			//10m shutdown for universe kill command
+			if (Game::universeShutdownRequested) {
+				if (framesSinceKillUniverseCommand >= shutdownUniverseTime) {
+					//Break main loop and exit
+					Game::lastSignal = -1;
+				} else
+					framesSinceKillUniverseCommand++;
+			}
 
-		const auto instances = Game::im->GetInstances();
+			const auto instances = Game::im->GetInstances();
 
-		for (auto* instance : instances) {
-			if (instance == nullptr) {
-				break;
-			}
+			for (auto* instance : instances) {
+				if (instance == nullptr) {
+					break;
+				}
 
-			auto affirmTimeout = instance->GetAffirmationTimeout();
+				auto affirmTimeout = instance->GetAffirmationTimeout();
 
-			if (!instance->GetPendingAffirmations().empty()) {
-				affirmTimeout++;
-			} else {
-				affirmTimeout = 0;
-			}
+				if (!instance->GetPendingAffirmations().empty()) {
+					affirmTimeout++;
+				} else {
+					affirmTimeout = 0;
+				}
 
-			instance->SetAffirmationTimeout(affirmTimeout);
+				instance->SetAffirmationTimeout(affirmTimeout);
 
-			if (affirmTimeout == instanceReadyTimeout) {
-				instance->Shutdown();
-				instance->SetIsShuttingDown(true);
+				if (affirmTimeout == instanceReadyTimeout) {
+					instance->Shutdown();
+					instance->SetIsShuttingDown(true);
 
-				Game::im->RedirectPendingRequests(instance);
+					Game::im->RedirectPendingRequests(instance);
+				}
 			}
-		}
 
-		//Remove dead instances
-		for (auto* instance : instances) {
-			if (instance == nullptr) {
-				break;
-			}
+			//Remove dead instances
+			for (auto* instance : instances) {
+				if (instance == nullptr) {
+					break;
+				}
 
-			if (instance->GetShutdownComplete()) {
-				Game::im->RemoveInstance(instance);
+				if (instance->GetShutdownComplete()) {
+					Game::im->RemoveInstance(instance);
+				}
 			}
 		}
 
-		t += std::chrono::milliseconds(masterFrameDelta);
-		std::this_thread::sleep_until(t);
+		//Sleep until the next frame, or until a packet arrives.
+		Game::server->WaitForPackets(t);
 	}
 	return ShutdownSequence(EXIT_SUCCESS);
 }
@@ -474,15 +494,16 @@ void HandlePacket(Packet* packet) {
 
 	if (static_cast<eConnectionType>(packet->data[1]) == eConnectionType::MASTER) {
 		switch (static_cast<eMasterMessageType>(packet->data[3])) {
-		case eMasterMessageType::REQUEST_PERSISTENT_ID: {
-			LOG("A persistent ID req");
+		case eMasterMessageType::REQUEST_PERSISTENT_ID_BLOCK: {
 			RakNet::BitStream inStream(packet->data, packet->length, false);
 			uint64_t header = inStream.Read(header);
-			uint64_t requestID = 0;
-			inStream.Read(requestID);
+			uint32_t count = 0;
+			inStream.Read(count);
+			count = std::clamp<uint32_t>(count, 1, PersistentIDManager::MaxLeaseSize);
 
-			uint32_t objID = PersistentIDManager::GeneratePersistentID();
-			MasterPackets::SendPersistentIDResponse(Game::server, packet->systemAddress, requestID, objID);
+			const auto firstID = PersistentIDManager::LeasePersistentIDs(count);
+			LOG("Leased persistent IDs %u to %u to %s", firstID, firstID + count - 1, packet->systemAddress.ToString());
+			MasterPackets::SendPersistentIDBlockResponse(Game::server, packet->systemAddress, firstID, count);
 			break;
 		}
 
@@ -856,11 +877,9 @@ int ShutdownSequence(int32_t signal) {
 	bool allInstancesShutdown = false;
 	Packet* packet = nullptr;
 	while (true) {
-		packet = Game::server->Receive();
-		if (packet) {
+		while ((packet = Game::server->Receive())) {
 			HandlePacket(packet);
 			Game::server->DeallocatePacket(packet);
-			packet = nullptr;
 		}
 
 		allInstancesShutdown = true;
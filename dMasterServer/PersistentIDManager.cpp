@@ -31,13 +31,14 @@ void PersistentIDManager::Initialize() {
 	}
 }
 
-//! Generates a new persistent ID
-uint32_t PersistentIDManager::GeneratePersistentID() {
-	uint32_t toReturn = ++CurrentPersistentID;
+//! Leases a block of consecutive persistent IDs
+uint32_t PersistentIDManager::LeasePersistentIDs(const uint32_t count) {
+	const uint32_t firstID = CurrentPersistentID + 1;
+	CurrentPersistentID += count;
 
 	SaveToDatabase();
 
-	return toReturn;
+	return firstID;
 }
 
 void PersistentIDManager::SaveToDatabase() {
@@ -3,6 +3,8 @@
 // C++
 #include <cstdint>
 
+#include "MasterPackets.h"
+
 /*!
   \file PersistentIDManager.h
   \brief A manager that handles requests for object IDs
@@ -10,14 +12,20 @@
 
  //! The Object ID Manager
 namespace PersistentIDManager {
+	//! The most IDs a single lease may contain
+	constexpr uint32_t MaxLeaseSize = MasterPackets::MaxPersistentIDBlockSize;
+
 	//! Initializes the manager
 	void Initialize();
 
-	//! Generates a new persistent ID
+	//! Leases a block of consecutive persistent IDs
 	/*!
-	  \return The new persistent ID
+	  The block is saved to the database before it is returned, so its IDs are never handed out again,
+	  even when the master or the world using them crashes.
+	  \param count The number of IDs in the block
+	  \return The first persistent ID of the block
 	 */
-	uint32_t GeneratePersistentID();
+	uint32_t LeasePersistentIDs(const uint32_t count);
 
 	void SaveToDatabase();
 };
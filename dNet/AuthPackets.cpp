@@ -14,6 +14,8 @@
 
 #include "BitStream.h"
 #include <future>
+#include <memory>
+#include <unordered_map>
 
 #include "Game.h"
 #include "dConfig.h"
@@ -24,8 +26,36 @@
 #include "eMasterMessageType.h"
 #include "eGameMasterLevel.h"
 #include "StringifiedEnum.h"
+#include "LoginWorkerPool.h"
+
 namespace {
 	std::vector<uint32_t> claimCodes;
+
+	std::unique_ptr<LoginWorkerPool> loginWorkers;
+
+	struct LoginAttempts {
+		std::chrono::steady_clock::time_point windowStart;
+		uint32_t count = 0;
+	};
+
+	constexpr auto loginAttemptWindow = std::chrono::minutes(1);
+	uint32_t maxLoginAttemptsPerMinute = 0;
+	// Keyed by the binary address of the client, the port changes with every connection
+	std::unordered_map<uint32_t, LoginAttempts> loginAttempts;
+	uint64_t rateLimitedLogins = 0;
+
+	bool IsRateLimited(const SystemAddress& sysAddr) {
+		if (maxLoginAttemptsPerMinute == 0) return false;
+
+		const auto now = std::chrono::steady_clock::now();
+		auto& attempts = loginAttempts[sysAddr.binaryAddress];
+		if (attempts.count == 0 || now - attempts.windowStart >= loginAttemptWindow) {
+			attempts.windowStart = now;
+			attempts.count = 0;
+		}
+
+		return ++attempts.count > maxLoginAttemptsPerMinute;
+	}
 }
 
 void Stamp::Serialize(RakNet::BitStream& outBitStream){
@@ -45,6 +75,40 @@ void AuthPackets::LoadClaimCodes() {
 	}
 }
 
+void AuthPackets::StartLoginWorkers(dServer* server) {
+	if (loginWorkers) return;
+
+	const auto hardwareThreads = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+	const auto threadCount = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("login_worker_threads")).value_or(0);
+	const auto maxQueuedLogins = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("max_queued_logins")).value_or(256);
+	maxLoginAttemptsPerMinute = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("max_login_attempts_per_minute")).value_or(10);
+
+	loginWorkers = std::make_unique<LoginWorkerPool>(threadCount == 0 ? hardwareThreads : threadCount, maxQueuedLogins, [server]() { server->WakeUp(); });
+	LOG("Started %u login worker threads, at most %u queued logins", loginWorkers->GetThreadCount(), maxQueuedLogins);
+}
+
+void AuthPackets::StopLoginWorkers() {
+	loginWorkers.reset();
+}
+
+void AuthPackets::ProcessCompletedLogins() {
+	if (loginWorkers) loginWorkers->ProcessCompletedJobs();
+}
+
+void AuthPackets::LogLoginMetrics() {
+	// Forget the addresses whose window ran out, so the map only holds recent clients
+	const auto now = std::chrono::steady_clock::now();
+	std::erase_if(loginAttempts, [now](const auto& entry) { return now - entry.second.windowStart >= loginAttemptWindow; });
+
+	if (!loginWorkers) return;
+
+	const auto metrics = loginWorkers->GetMetrics(true);
+	if (metrics.peakQueueDepth == 0 && metrics.rejected == 0 && rateLimitedLogins == 0) return;
+
+	LOG("Login queue: depth %u, peak %u, completed %llu, rejected %llu, rate limited %llu",
+		metrics.queueDepth, metrics.peakQueueDepth, metrics.completed, metrics.rejected, rateLimitedLogins);
+}
+
 void AuthPackets::HandleHandshake(dServer* server, Packet* packet) {
 	CINSTREAM_SKIP_HEADER
 	uint32_t clientVersion = 0;
@@ -141,6 +205,14 @@ void AuthPackets::HandleLoginRequest(dServer* server, Packet* packet) {
 	inStream.Read(platformID);
 	LOG_DEBUG("OS Info: [Size: %i, Major: %i, Minor %i, Buid#: %i, platformID: %i]", osVersionInfoSize, majorVersion, minorVersion, buildNumber, platformID);
 
+	if (IsRateLimited(packet->systemAddress)) {
+		rateLimitedLogins++;
+		stamps.emplace_back(eStamps::PASSPORT_AUTH_ERROR, 1);
+		AuthPackets::SendLoginResponse(server, packet->systemAddress, eLoginResponse::GENERAL_FAILED, "Too many login attempts, please wait a minute and try again.", "", 2001, username, stamps);
+		LOG("Rate limited login for user %s", username.c_str());
+		return;
+	}
+
 	// Fetch account details
 	auto accountInfo = Database::Get()->GetAccountInfo(username);
 
@@ -199,28 +271,45 @@ void AuthPackets::HandleLoginRequest(dServer* server, Packet* packet) {
 		return;
 	}
 
-	bool loginSuccess = ::bcrypt_checkpw(password.GetAsString().c_str(), accountInfo->bcryptPassword.c_str()) == 0;
+	// Checking the hash is by far the slowest part of a login, so it runs on a worker thread
+	// and the login is finished from the main loop once it is done.
+	const auto accountId = accountInfo->id;
+	const SystemAddress system = packet->systemAddress; //Copy the sysAddr before the Packet gets destroyed from main
+	auto onChecked = [server, system, username, stamps, accountId](bool loginSuccess) mutable {
+		if (!loginSuccess) {
+			stamps.emplace_back(eStamps::PASSPORT_AUTH_ERROR, 1);
+			AuthPackets::SendLoginResponse(server, system, eLoginResponse::WRONG_PASS, "", "", 2001, username, stamps);
+			LOG("Wrong password used");
+		} else {
+			if (!server->GetIsConnectedToMaster()) {
+				stamps.emplace_back(eStamps::PASSPORT_AUTH_WORLD_DISCONNECT, 1);
+				AuthPackets::SendLoginResponse(server, system, eLoginResponse::GENERAL_FAILED, "", "", 0, username, stamps);
+				return;
+			}
+			stamps.emplace_back(eStamps::PASSPORT_AUTH_WORLD_SESSION_CONFIRM_TO_AUTH, 1);
+			ZoneInstanceManager::Instance()->RequestZoneTransfer(server, 0, 0, false, [system, server, username, stamps](bool mythranShift, uint32_t zoneID, uint32_t zoneInstance, uint32_t zoneClone, std::string zoneIP, uint16_t zonePort) mutable {
+				AuthPackets::SendLoginResponse(server, system, eLoginResponse::SUCCESS, "", zoneIP, zonePort, username, stamps);
+				});
+		}
 
-	if (!loginSuccess) {
-		stamps.emplace_back(eStamps::PASSPORT_AUTH_ERROR, 1);
-		AuthPackets::SendLoginResponse(server, packet->systemAddress, eLoginResponse::WRONG_PASS, "", "", 2001, username, stamps);
-		LOG("Wrong password used");
-	} else {
-		SystemAddress system = packet->systemAddress; //Copy the sysAddr before the Packet gets destroyed from main
-
-		if (!server->GetIsConnectedToMaster()) {
-			stamps.emplace_back(eStamps::PASSPORT_AUTH_WORLD_DISCONNECT, 1);
-			AuthPackets::SendLoginResponse(server, system, eLoginResponse::GENERAL_FAILED, "", "", 0, username, stamps);
-			return;
+		for(auto const code: claimCodes){
+			Database::Get()->InsertRewardCode(accountId, code);
 		}
-		stamps.emplace_back(eStamps::PASSPORT_AUTH_WORLD_SESSION_CONFIRM_TO_AUTH, 1);
-		ZoneInstanceManager::Instance()->RequestZoneTransfer(server, 0, 0, false, [system, server, username, stamps](bool mythranShift, uint32_t zoneID, uint32_t zoneInstance, uint32_t zoneClone, std::string zoneIP, uint16_t zonePort) mutable {
-			AuthPackets::SendLoginResponse(server, system, eLoginResponse::SUCCESS, "", zoneIP, zonePort, username, stamps);
-			});
+	};
+
+	auto checkPassword = [password = password.GetAsString(), hash = accountInfo->bcryptPassword]() {
+		return ::bcrypt_checkpw(password.c_str(), hash.c_str()) == 0;
+	};
+
+	if (!loginWorkers) {
+		onChecked(checkPassword());
+		return;
 	}
 
-	for(auto const code: claimCodes){
-		Database::Get()->InsertRewardCode(accountInfo->id, code);
+	if (!loginWorkers->Submit(std::move(checkPassword), std::move(onChecked))) {
+		stamps.emplace_back(eStamps::PASSPORT_AUTH_ERROR, 1);
+		AuthPackets::SendLoginResponse(server, system, eLoginResponse::GENERAL_FAILED, "The server is busy, please try again in a moment.", "", 2001, username, stamps);
+		LOG("Login queue is full, turned away user %s", username.c_str());
 	}
 }
 
@@ -99,6 +99,16 @@ namespace AuthPackets {
 	void SendLoginResponse(dServer* server, const SystemAddress& sysAddr, eLoginResponse responseCode, const std::string& errorMsg, const std::string& wServerIP, uint16_t wServerPort, std::string username, std::vector<Stamp>& stamps);
 	void LoadClaimCodes();
 
+	// Starts the worker threads that check passwords, without them passwords are checked on the calling thread.
+	void StartLoginWorkers(dServer* server);
+	void StopLoginWorkers();
+
+	// Finishes the logins whose password check completed, must be called from the main loop.
+	void ProcessCompletedLogins();
+
+	// Logs the login queue metrics since the last call and forgets expired rate limit windows.
+	void LogLoginMetrics();
+
 }
 
 #endif // AUTHPACKETS_H
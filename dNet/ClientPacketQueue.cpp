@@ -0,0 +1,115 @@
+#include "ClientPacketQueue.h"
+
+#include "dServer.h"
+#include "Game.h"
+#include "Logger.h"
+#include "MessageIdentifiers.h"
+
+#include <ranges>
+
+namespace {
+	constexpr auto packetRateWindow = std::chrono::seconds(1);
+
+	// Every user packet starts with the packet id, the connection type, the message type and a padding byte.
+	constexpr uint32_t userPacketHeaderSize = 4;
+}
+
+uint64_t ClientPacketQueue::GetKey(const SystemAddress& sysAddr) {
+	return (static_cast<uint64_t>(sysAddr.binaryAddress) << 16) | sysAddr.port;
+}
+
+uint32_t ClientPacketQueue::ReceiveFrom(dServer* server, const uint32_t maxPackets) {
+	const auto now = std::chrono::steady_clock::now();
+
+	// Forget the clients that have nothing queued and did not send anything for a while
+	std::erase_if(m_Clients, [now](const auto& entry) {
+		return entry.second.packets.empty() && now - entry.second.rateWindowStart >= packetRateWindow;
+	});
+
+	uint32_t received = 0;
+	Packet* packet = nullptr;
+	while (received < maxPackets && (packet = server->Receive())) {
+		if (packet->length < 1 || (packet->data[0] == ID_USER_PACKET_ENUM && packet->length < userPacketHeaderSize)) {
+			m_Dropped++;
+			server->DeallocatePacket(packet);
+			continue;
+		}
+
+		const auto key = GetKey(packet->systemAddress);
+		auto [it, inserted] = m_Clients.try_emplace(key);
+		auto& client = it->second;
+		if (inserted) client.sysAddr = packet->systemAddress;
+
+		TrackPacketRate(client, now);
+
+		if (client.packets.empty()) m_Rotation.push_back(key);
+		client.packets.push_back(packet);
+		m_Queued++;
+		received++;
+	}
+
+	return received;
+}
+
+Packet* ClientPacketQueue::Pop() {
+	while (!m_Rotation.empty()) {
+		const auto key = m_Rotation.front();
+		m_Rotation.pop_front();
+
+		const auto it = m_Clients.find(key);
+		if (it == m_Clients.end() || it->second.packets.empty()) continue;
+
+		auto& packets = it->second.packets;
+		auto* packet = packets.front();
+		packets.pop_front();
+		m_Queued--;
+
+		// Back of the line for the next packet of this client
+		if (!packets.empty()) m_Rotation.push_back(key);
+
+		return packet;
+	}
+
+	return nullptr;
+}
+
+void ClientPacketQueue::Clear(dServer* server) {
+	for (auto& client : m_Clients | std::views::values) {
+		for (auto* packet : client.packets) server->DeallocatePacket(packet);
+	}
+
+	m_Clients.clear();
+	m_Rotation.clear();
+	m_Queued = 0;
+}
+
+uint32_t ClientPacketQueue::GetPacketRate(const SystemAddress& sysAddr) const {
+	const auto it = m_Clients.find(GetKey(sysAddr));
+	if (it == m_Clients.end()) return 0;
+
+	if (std::chrono::steady_clock::now() - it->second.rateWindowStart >= packetRateWindow) return 0;
+	return it->second.packetsInWindow;
+}
+
+ClientPacketQueue::Metrics ClientPacketQueue::GetMetrics() const {
+	Metrics metrics;
+	metrics.queued = m_Queued;
+	metrics.clients = m_Rotation.size();
+	metrics.dropped = m_Dropped;
+	return metrics;
+}
+
+void ClientPacketQueue::TrackPacketRate(ClientQueue& client, const std::chrono::steady_clock::time_point now) {
+	if (now - client.rateWindowStart >= packetRateWindow) {
+		client.rateWindowStart = now;
+		client.packetsInWindow = 0;
+		client.warned = false;
+	}
+
+	client.packetsInWindow++;
+
+	if (m_PacketRateWarning != 0 && !client.warned && client.packetsInWindow > m_PacketRateWarning) {
+		client.warned = true;
+		LOG("Client %s sent more than %u packets in a second", client.sysAddr.ToString(), m_PacketRateWarning);
+	}
+}
@@ -0,0 +1,76 @@
+#ifndef __CLIENTPACKETQUEUE__H__
+#define __CLIENTPACKETQUEUE__H__
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+
+#include "RakNetTypes.h"
+
+class dServer;
+
+/**
+ * Queues the packets of every client separately and hands them out round-robin,
+ * so one chatty client can not use up the packet budget of a frame on its own.
+ * Packets of a single client are always handed out in the order they arrived.
+ */
+class ClientPacketQueue {
+public:
+	struct Metrics {
+		uint32_t queued = 0;
+		uint32_t clients = 0;
+		// Packets dropped because their header was too short to be handled
+		uint64_t dropped = 0;
+	};
+
+	/**
+	 * @param packetRateWarning Logs a warning when a client sends more packets than this in a second, 0 disables the warning
+	 */
+	explicit ClientPacketQueue(const uint32_t packetRateWarning = 0) : m_PacketRateWarning{ packetRateWarning } {};
+
+	/**
+	 * Takes every packet waiting in the server, up to maxPackets, and queues it for its client.
+	 *
+	 * @return The number of packets that were queued
+	 */
+	uint32_t ReceiveFrom(dServer* server, const uint32_t maxPackets);
+
+	/**
+	 * @return The oldest packet of the next client in the rotation, or nullptr if nothing is queued.
+	 * The caller has to deallocate the packet.
+	 */
+	Packet* Pop();
+
+	// Deallocates every queued packet
+	void Clear(dServer* server);
+
+	/**
+	 * @return The packets the client sent in the current one second window
+	 */
+	uint32_t GetPacketRate(const SystemAddress& sysAddr) const;
+
+	Metrics GetMetrics() const;
+
+private:
+	struct ClientQueue {
+		SystemAddress sysAddr;
+		std::deque<Packet*> packets;
+		std::chrono::steady_clock::time_point rateWindowStart;
+		uint32_t packetsInWindow = 0;
+		bool warned = false;
+	};
+
+	static uint64_t GetKey(const SystemAddress& sysAddr);
+
+	void TrackPacketRate(ClientQueue& client, const std::chrono::steady_clock::time_point now);
+
+	std::unordered_map<uint64_t, ClientQueue> m_Clients;
+	// Clients with queued packets, in the order they get their next turn
+	std::deque<uint64_t> m_Rotation;
+	uint32_t m_Queued = 0;
+	uint64_t m_Dropped = 0;
+	uint32_t m_PacketRateWarning = 0;
+};
+
+#endif  //!__CLIENTPACKETQUEUE__H__
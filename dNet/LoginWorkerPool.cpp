@@ -0,0 +1,90 @@
+#include "LoginWorkerPool.h"
+
+#include <algorithm>
+
+LoginWorkerPool::LoginWorkerPool(uint32_t threadCount, uint32_t maxQueuedJobs, std::function<void()> onJobFinished) {
+	m_MaxQueuedJobs = std::max<uint32_t>(maxQueuedJobs, 1);
+	m_OnJobFinished = std::move(onJobFinished);
+
+	threadCount = std::max<uint32_t>(threadCount, 1);
+	m_Threads.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		m_Threads.emplace_back(&LoginWorkerPool::WorkerLoop, this);
+	}
+}
+
+LoginWorkerPool::~LoginWorkerPool() {
+	{
+		std::lock_guard lock(m_Mutex);
+		m_Stopping = true;
+	}
+	m_Condition.notify_all();
+
+	for (auto& thread : m_Threads) {
+		if (thread.joinable()) thread.join();
+	}
+}
+
+bool LoginWorkerPool::Submit(Work work, Completion onComplete) {
+	{
+		std::lock_guard lock(m_Mutex);
+		if (m_Pending.size() + m_Running >= m_MaxQueuedJobs) {
+			m_Metrics.rejected++;
+			return false;
+		}
+
+		m_Pending.push(Job{ std::move(work), std::move(onComplete) });
+		m_Metrics.peakQueueDepth = std::max<uint32_t>(m_Metrics.peakQueueDepth, m_Pending.size() + m_Running);
+	}
+	m_Condition.notify_one();
+	return true;
+}
+
+uint32_t LoginWorkerPool::ProcessCompletedJobs() {
+	std::vector<Job> finished;
+	{
+		std::lock_guard lock(m_Mutex);
+		finished.swap(m_Finished);
+	}
+
+	for (auto& job : finished) {
+		if (job.onComplete) job.onComplete(job.result);
+	}
+
+	return finished.size();
+}
+
+LoginWorkerPool::Metrics LoginWorkerPool::GetMetrics(const bool resetPeak) {
+	std::lock_guard lock(m_Mutex);
+	auto metrics = m_Metrics;
+	metrics.queueDepth = m_Pending.size() + m_Running;
+	if (resetPeak) m_Metrics.peakQueueDepth = metrics.queueDepth;
+	return metrics;
+}
+
+void LoginWorkerPool::WorkerLoop() {
+	while (true) {
+		Job job;
+		{
+			std::unique_lock lock(m_Mutex);
+			m_Condition.wait(lock, [this]() { return m_Stopping || !m_Pending.empty(); });
+			if (m_Stopping) return;
+
+			job = std::move(m_Pending.front());
+			m_Pending.pop();
+			m_Running++;
+		}
+
+		job.result = job.work ? job.work() : false;
+
+		{
+			std::lock_guard lock(m_Mutex);
+			m_Running--;
+			m_Metrics.completed++;
+			m_Finished.push_back(std::move(job));
+		}
+
+		// Only called once the job is published, so whoever it wakes up finds the job
+		if (m_OnJobFinished) m_OnJobFinished();
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef __LOGINWORKERPOOL__H__
+#define __LOGINWORKERPOOL__H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * A bounded pool of worker threads for the slow parts of a login, like checking a bcrypt hash.
+ * Work runs on a worker thread, its completion is handed back to the thread that calls ProcessCompletedJobs,
+ * so completions can safely touch the server and the database.
+ */
+class LoginWorkerPool {
+public:
+	using Work = std::function<bool()>;
+	using Completion = std::function<void(bool)>;
+
+	struct Metrics {
+		// Jobs waiting for or running on a worker
+		uint32_t queueDepth = 0;
+		// Highest queue depth since the last call to GetMetrics that reset it
+		uint32_t peakQueueDepth = 0;
+		uint64_t completed = 0;
+		// Jobs refused because the queue was full
+		uint64_t rejected = 0;
+	};
+
+	/**
+	 * @param threadCount The number of worker threads, at least one is always started
+	 * @param maxQueuedJobs The most jobs that may be waiting for or running on a worker at once
+	 * @param onJobFinished Called on the worker thread whenever a job finished, used to wake up the main loop
+	 */
+	LoginWorkerPool(uint32_t threadCount, uint32_t maxQueuedJobs, std::function<void()> onJobFinished = nullptr);
+	~LoginWorkerPool();
+
+	LoginWorkerPool(const LoginWorkerPool&) = delete;
+	LoginWorkerPool& operator=(const LoginWorkerPool&) = delete;
+
+	/**
+	 * Queues work to run on a worker thread.
+	 *
+	 * @param work The work to run, its result is passed to onComplete
+	 * @param onComplete Called with the result of the work from ProcessCompletedJobs
+	 * @return false if the queue is full and the work was not queued
+	 */
+	bool Submit(Work work, Completion onComplete);
+
+	/**
+	 * Runs the completions of every job that finished since the last call.
+	 *
+	 * @return The number of completions that were run
+	 */
+	uint32_t ProcessCompletedJobs();
+
+	Metrics GetMetrics(const bool resetPeak = false);
+
+	uint32_t GetThreadCount() const { return m_Threads.size(); }
+
+private:
+	struct Job {
+		Work work;
+		Completion onComplete;
+		bool result = false;
+	};
+
+	void WorkerLoop();
+
+	std::mutex m_Mutex;
+	std::condition_variable m_Condition;
+	std::queue<Job> m_Pending;
+	std::vector<Job> m_Finished;
+	std::vector<std::thread> m_Threads;
+	std::function<void()> m_OnJobFinished;
+	uint32_t m_MaxQueuedJobs = 0;
+	uint32_t m_Running = 0;
+	Metrics m_Metrics;
+	bool m_Stopping = false;
+};
+
+#endif  //!__LOGINWORKERPOOL__H__
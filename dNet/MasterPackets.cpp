@@ -8,19 +8,19 @@
 
 #include <string>
 
-void MasterPackets::SendPersistentIDRequest(dServer* server, uint64_t requestID) {
+void MasterPackets::SendPersistentIDBlockRequest(dServer* server, uint32_t count) {
 	CBITSTREAM;
-	BitStreamUtils::WriteHeader(bitStream, eConnectionType::MASTER, eMasterMessageType::REQUEST_PERSISTENT_ID);
-	bitStream.Write(requestID);
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::MASTER, eMasterMessageType::REQUEST_PERSISTENT_ID_BLOCK);
+	bitStream.Write(count);
 	server->SendToMaster(bitStream);
 }
 
-void MasterPackets::SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID) {
+void MasterPackets::SendPersistentIDBlockResponse(dServer* server, const SystemAddress& sysAddr, uint32_t firstID, uint32_t count) {
 	RakNet::BitStream bitStream;
-	BitStreamUtils::WriteHeader(bitStream, eConnectionType::MASTER, eMasterMessageType::REQUEST_PERSISTENT_ID_RESPONSE);
+	BitStreamUtils::WriteHeader(bitStream, eConnectionType::MASTER, eMasterMessageType::REQUEST_PERSISTENT_ID_BLOCK_RESPONSE);
 
-	bitStream.Write(requestID);
-	bitStream.Write(objID);
+	bitStream.Write(firstID);
+	bitStream.Write(count);
 
 	server->Send(bitStream, sysAddr, false);
 }
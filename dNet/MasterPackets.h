@@ -8,8 +8,11 @@
 class dServer;
 
 namespace MasterPackets {
-	void SendPersistentIDRequest(dServer* server, uint64_t requestID); //Called from the World server
-	void SendPersistentIDResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, uint32_t objID);
+	//! The most persistent IDs a world may request in one block, the master never leases more at once
+	constexpr uint32_t MaxPersistentIDBlockSize = 10000;
+
+	void SendPersistentIDBlockRequest(dServer* server, uint32_t count); //Called from the World server
+	void SendPersistentIDBlockResponse(dServer* server, const SystemAddress& sysAddr, uint32_t firstID, uint32_t count);
 
 	void SendZoneTransferRequest(dServer* server, uint64_t requestID, bool mythranShift, uint32_t zoneID, uint32_t cloneID);
 	void SendZoneTransferResponse(dServer* server, const SystemAddress& sysAddr, uint64_t requestID, bool mythranShift, uint32_t zoneID, uint32_t zoneInstance, uint32_t zoneClone, const std::string& serverIP, uint32_t serverPort);
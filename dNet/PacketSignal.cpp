@@ -0,0 +1,20 @@
+#include "PacketSignal.h"
+
+void PacketSignal::OnPacketQueued(RakPeerInterface* peer) {
+	Notify();
+}
+
+void PacketSignal::Notify() {
+	{
+		std::lock_guard lock(m_Mutex);
+		m_Signaled = true;
+	}
+	m_Condition.notify_one();
+}
+
+bool PacketSignal::WaitUntil(const std::chrono::steady_clock::time_point deadline) {
+	std::unique_lock lock(m_Mutex);
+	const bool signaled = m_Condition.wait_until(lock, deadline, [this]() { return m_Signaled; });
+	m_Signaled = false;
+	return signaled;
+}
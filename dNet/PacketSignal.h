@@ -0,0 +1,35 @@
+#ifndef __PACKETSIGNAL__H__
+#define __PACKETSIGNAL__H__
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "PluginInterface.h"
+
+/**
+ * RakNet plugin that lets a thread sleep until a packet is ready on any peer it is attached to.
+ * RakNet reads the sockets on its own network thread, which calls OnPacketQueued once a packet can be received.
+ */
+class PacketSignal : public PluginInterface {
+public:
+	void OnPacketQueued(RakPeerInterface* peer) override;
+
+	// Wakes the waiting thread, safe to call from any thread.
+	void Notify();
+
+	/**
+	 * Blocks until a packet was queued since the last call or the deadline passed.
+	 *
+	 * @param deadline The latest time to return at
+	 * @return true if a packet was queued, false if the deadline passed
+	 */
+	bool WaitUntil(const std::chrono::steady_clock::time_point deadline);
+
+private:
+	std::mutex m_Mutex;
+	std::condition_variable m_Condition;
+	bool m_Signaled = false;
+};
+
+#endif  //!__PACKETSIGNAL__H__
@@ -65,11 +65,13 @@ dServer::dServer(const std::string& ip, int port, int instanceID, int maxConnect
 
 	if (mIsOkay) {
 		if (zoneID == 0)
-			LOG("%s Server is listening on %s:%i with encryption: %i", StringifiedEnum::ToString(serverType).data(), ip.c_str(), port, int(useEncryption));
+			LOG("%s Server is listening on %s:%i with encryption: %i", StringifiedEnum::ToString(serverType).data(), ip.c_str(), mPort, int(useEncryption));
 		else
-			LOG("%s Server is listening on %s:%i with encryption: %i, running zone %i / %i", StringifiedEnum::ToString(serverType).data(), ip.c_str(), port, int(useEncryption), zoneID, instanceID);
+			LOG("%s Server is listening on %s:%i with encryption: %i, running zone %i / %i", StringifiedEnum::ToString(serverType).data(), ip.c_str(), mPort, int(useEncryption), zoneID, instanceID);
 	} else { LOG("FAILED TO START SERVER ON IP/PORT: %s:%i", ip.c_str(), port); return; }
 
+	// The messages above are written by the logging thread, let them reach the console first
+	mLogger->Flush();
 	mLogger->SetLogToConsole(prevLogSetting);
 
 	//Connect to master if we are not master:
@@ -82,6 +84,8 @@ dServer::dServer(const std::string& ip, int port, int instanceID, int maxConnect
 
 	//Set up Replica if we're a world server:
 	if (serverType == ServerType::World) {
+		mAggregateSends = mConfig->GetValue("aggregate_game_messages") == "1";
+
 		mNetIDManager = new NetworkIDManager();
 		mNetIDManager->SetIsNetworkIDAuthority(true);
 
@@ -105,7 +109,21 @@ Packet* dServer::ReceiveFromMaster() {
 	if (!mMasterPeer) return nullptr;
 	if (!mMasterConnectionActive) ConnectToMaster();
 
-	Packet* packet = mMasterPeer->Receive();
+	return HandleMasterPacket(mMasterPeer->Receive());
+}
+
+void dServer::ReceiveAllFromMaster() {
+	if (!mMasterPeer) return;
+	if (!mMasterConnectionActive) ConnectToMaster();
+
+	Packet* packet = nullptr;
+	while ((packet = mMasterPeer->Receive())) {
+		Packet* unhandled = HandleMasterPacket(packet);
+		if (unhandled) mMasterPeer->DeallocatePacket(unhandled);
+	}
+}
+
+Packet* dServer::HandleMasterPacket(Packet* packet) {
 	if (packet) {
 		if (packet->length < 1) { mMasterPeer->DeallocatePacket(packet); return nullptr; }
 
@@ -151,6 +169,15 @@ Packet* dServer::Receive() {
 	return mPeer->Receive();
 }
 
+void dServer::WaitForPackets(const std::chrono::steady_clock::time_point deadline) {
+	// Packets queued since the caller last drained Receive leave the signal set, so none of them wait for the deadline
+	if (mPacketSignal) mPacketSignal->WaitUntil(deadline);
+}
+
+void dServer::WakeUp() {
+	if (mPacketSignal) mPacketSignal->Notify();
+}
+
 void dServer::DeallocatePacket(Packet* packet) {
 	mPeer->DeallocatePacket(packet);
 }
@@ -160,9 +187,52 @@ void dServer::DeallocateMasterPacket(Packet* packet) {
 }
 
 void dServer::Send(RakNet::BitStream& bitStream, const SystemAddress& sysAddr, bool broadcast) {
+	// Anything queued for this client has to go out first or it would arrive out of order.
+	if (!mQueuedSends.empty()) {
+		if (broadcast) FlushQueuedSends();
+		else FlushQueuedSends(sysAddr);
+	}
+
 	mPeer->Send(&bitStream, SYSTEM_PRIORITY, RELIABLE_ORDERED, 0, sysAddr, broadcast);
 }
 
+void dServer::QueueSend(RakNet::BitStream& bitStream, const SystemAddress& sysAddr) {
+	if (!mAggregateSends || sysAddr == UNASSIGNED_SYSTEM_ADDRESS) {
+		Send(bitStream, sysAddr, sysAddr == UNASSIGNED_SYSTEM_ADDRESS);
+		return;
+	}
+
+	if (bitStream.GetNumberOfBitsUsed() == 0) return;
+
+	auto& queued = mQueuedSends[sysAddr];
+	queued.data.WriteAlignedBytes(bitStream.GetData(), bitStream.GetNumberOfBytesUsed());
+	queued.packetBits.push_back(bitStream.GetNumberOfBitsUsed());
+}
+
+void dServer::FlushQueuedSends() {
+	for (auto& [sysAddr, queued] : mQueuedSends) SendQueued(sysAddr, queued);
+
+	mQueuedSends.clear();
+}
+
+void dServer::FlushQueuedSends(const SystemAddress& sysAddr) {
+	const auto queued = mQueuedSends.find(sysAddr);
+	if (queued == mQueuedSends.end()) return;
+
+	SendQueued(sysAddr, queued->second);
+	mQueuedSends.erase(queued);
+}
+
+void dServer::SendQueued(const SystemAddress& sysAddr, QueuedSends& queued) {
+	auto* data = queued.data.GetData();
+	for (const auto bits : queued.packetBits) {
+		RakNet::BitStream packet(data, BITS_TO_BYTES(bits), false);
+		packet.SetWriteOffset(bits);
+		mPeer->Send(&packet, SYSTEM_PRIORITY, RELIABLE_ORDERED, 0, sysAddr, false);
+		data += BITS_TO_BYTES(bits);
+	}
+}
+
 void dServer::SendToMaster(RakNet::BitStream& bitStream) {
 	if (!mMasterConnectionActive) ConnectToMaster();
 	mMasterPeer->Send(&bitStream, SYSTEM_PRIORITY, RELIABLE_ORDERED, 0, mMasterSystemAddress, false);
@@ -188,6 +258,12 @@ bool dServer::Startup() {
 	if (!mPeer) return false;
 	if (!mPeer->Startup(mMaxConnections, 10, &mSocketDescriptor, 1)) return false;
 
+	// Port 0 lets the system pick a free port, remember which one it was
+	if (mPort == 0) mPort = mPeer->GetInternalID().port;
+
+	mPacketSignal = std::make_unique<PacketSignal>();
+	mPeer->AttachPlugin(mPacketSignal.get());
+
 	if (mIsInternal) {
 		mPeer->SetIncomingPassword("3.25 DARKFLAME1", 15);
 	} else {
@@ -214,6 +290,7 @@ void dServer::UpdateBandwidthLimit() {
 
 void dServer::Shutdown() {
 	if (mPeer) {
+		if (mPacketSignal) mPeer->DetachPlugin(mPacketSignal.get());
 		mPeer->Shutdown(1000);
 		RakNetworkFactory::DestroyRakPeerInterface(mPeer);
 	}
@@ -229,6 +306,7 @@ void dServer::Shutdown() {
 	}
 
 	if (mServerType != ServerType::Master && mMasterPeer) {
+		if (mPacketSignal) mMasterPeer->DetachPlugin(mPacketSignal.get());
 		mMasterPeer->Shutdown(1000);
 		RakNetworkFactory::DestroyRakPeerInterface(mMasterPeer);
 	}
@@ -239,6 +317,7 @@ void dServer::SetupForMasterConnection() {
 	mMasterPeer = RakNetworkFactory::GetRakPeerInterface();
 	bool ret = mMasterPeer->Startup(1, 30, &mMasterSocketDescriptor, 1);
 	if (!ret) LOG("Failed MasterPeer Startup!");
+	if (mPacketSignal) mMasterPeer->AttachPlugin(mPacketSignal.get());
 }
 
 bool dServer::ConnectToMaster() {
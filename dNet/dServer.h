@@ -1,9 +1,15 @@
 #pragma once
+#include <chrono>
 #include <string>
 #include <csignal>
+#include <map>
+#include <memory>
+#include <vector>
 #include "RakPeerInterface.h"
+#include "BitStream.h"
 #include "ReplicaManager.h"
 #include "NetworkIDManager.h"
+#include "PacketSignal.h"
 
 class Logger;
 class dConfig;
@@ -49,10 +55,32 @@ public:
 	~dServer();
 
 	Packet* ReceiveFromMaster();
+
+	// Handles every packet waiting from the master, for servers that handle no master packets of their own.
+	void ReceiveAllFromMaster();
 	Packet* Receive();
+
+	/**
+	 * Sleeps until a packet arrives from a client or the master, or until the deadline passes.
+	 * Lets servers without a fixed frame rate handle packets as soon as they arrive instead of once per frame.
+	 */
+	void WaitForPackets(const std::chrono::steady_clock::time_point deadline);
+
+	// Makes a pending WaitForPackets return early, safe to call from any thread.
+	void WakeUp();
 	void DeallocatePacket(Packet* packet);
 	void DeallocateMasterPacket(Packet* packet);
 	virtual void Send(RakNet::BitStream& bitStream, const SystemAddress& sysAddr, bool broadcast);
+
+	/**
+	 * Queues a packet for a single client to be sent when FlushQueuedSends is called.
+	 * If aggregation is disabled the packet is sent immediately.
+	 * Any immediate Send to the same client flushes its queue first, so ordering is preserved.
+	 */
+	void QueueSend(RakNet::BitStream& bitStream, const SystemAddress& sysAddr);
+
+	// Hands every queued packet to RakNet in one burst so they can share datagrams.
+	void FlushQueuedSends();
 	void SendToMaster(RakNet::BitStream& bitStream);
 
 	void Disconnect(const SystemAddress& sysAddr, eServerDisconnectIdentifiers disconNotifyID);
@@ -86,6 +114,20 @@ private:
 	void SetupForMasterConnection();
 	bool ConnectToMaster();
 
+	// Handles a packet from the master, returns it if the caller has to handle it instead.
+	Packet* HandleMasterPacket(Packet* packet);
+	void FlushQueuedSends(const SystemAddress& sysAddr);
+
+	struct QueuedSends {
+		// All queued packets for a client, each starting on a byte boundary.
+		RakNet::BitStream data;
+
+		// The length in bits of every packet in data, in the order they were queued.
+		std::vector<BitSize_t> packetBits;
+	};
+
+	void SendQueued(const SystemAddress& sysAddr, QueuedSends& queued);
+
 private:
 	Logger* mLogger = nullptr;
 	dConfig* mConfig = nullptr;
@@ -109,6 +151,17 @@ private:
 	bool mMasterConnectionActive;
 	ServerType mServerType;
 
+	/**
+	 * Whether packets sent with QueueSend are held until the end of the frame.
+	 */
+	bool mAggregateSends = false;
+	std::map<SystemAddress, QueuedSends> mQueuedSends;
+
+	/**
+	 * Wakes WaitForPackets when a packet is ready on either peer.
+	 */
+	std::unique_ptr<PacketSignal> mPacketSignal;
+
 	RakPeerInterface* mMasterPeer = nullptr;
 	SocketDescriptor mMasterSocketDescriptor;
 	SystemAddress mMasterSystemAddress;
@@ -276,7 +276,7 @@ void SGCannon::DoSpawnTimerFunc(Entity* self, const std::string& name) {
 		LOG_DEBUG("%s", toSpawn.spawnPaths.at(pathIndex).c_str());
 		const auto* path = Game::zoneManager->GetZone()->GetPath(toSpawn.spawnPaths.at(pathIndex));
 		if (!path) {
-			LOG_DEBUG("Path %s at index %i is null", toSpawn.spawnPaths.at(pathIndex).c_str(), pathIndex);
+			LOG_DEBUG("Path %s at index %f is null", toSpawn.spawnPaths.at(pathIndex).c_str(), pathIndex);
 			return;
 		}
 
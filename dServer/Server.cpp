@@ -27,3 +27,8 @@ void Server::SetupLogger(const std::string_view serviceName) {
 	Game::logger->SetLogToConsole(Game::config->GetValue("log_to_console") != "0");
 	Game::logger->SetLogDebugStatements(Game::config->GetValue("log_debug_statements") == "1");
 }
+
+Server::LoggerGuard::~LoggerGuard() {
+	delete Game::logger;
+	Game::logger = nullptr;
+}
@@ -5,6 +5,16 @@
 
 namespace Server {
 	void SetupLogger(const std::string_view serviceName);
+
+	// Deletes Game::logger when it goes out of scope, which writes every message that is still waiting to be written
+	class LoggerGuard {
+	public:
+		LoggerGuard() = default;
+		~LoggerGuard();
+
+		LoggerGuard(const LoggerGuard&) = delete;
+		LoggerGuard& operator=(const LoggerGuard&) = delete;
+	};
 };
 
 #endif  //!__SERVER__H__
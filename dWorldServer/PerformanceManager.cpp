@@ -2,6 +2,11 @@
 #include "CDZoneTableTable.h"
 #include "CDClientManager.h"
 #include "UserManager.h"
+#include "Logger.h"
+#include "Metrics.hpp"
+
+#include <algorithm>
+#include <array>
 
 #define SOCIAL { lowFrameDelta }
 #define SOCIAL_HUB { mediumFrameDelta } //Added to compensate for the large playercounts in NS and NT
@@ -16,6 +21,34 @@ PerformanceProfile PerformanceManager::m_DefaultProfile = SOCIAL;
 
 PerformanceProfile PerformanceManager::m_InactiveProfile = { lowFrameDelta };
 
+float PerformanceManager::m_AverageWorkMs = 0.0f;
+
+uint32_t PerformanceManager::m_LoadLevel = 0;
+
+uint32_t PerformanceManager::m_FramesOverBudget = 0;
+
+uint32_t PerformanceManager::m_FramesUnderBudget = 0;
+
+bool PerformanceManager::m_Overloaded = false;
+
+namespace {
+	// The frame rates the server can step down through, fastest first
+	constexpr std::array<uint32_t, 3> frameDeltaTiers = { highFrameDelta, mediumFrameDelta, lowFrameDelta };
+
+	// Weight of the newest frame in the running average of the frame work time
+	constexpr float averageWeight = 0.1f;
+
+	// Share of the frame delta the work may take before the server counts as overloaded
+	constexpr float overloadedShare = 0.9f;
+
+	// Share of the faster frame delta the work has to stay under before the server steps back up
+	constexpr float recoveredShare = 0.5f;
+
+	// Frames the load has to stay over or under budget before the frame rate changes
+	constexpr uint32_t framesToStepDown = 30;
+	constexpr uint32_t framesToStepUp = 120;
+}
+
 std::map<LWOMAPID, PerformanceProfile> PerformanceManager::m_Profiles = {
 	// VE
 	{ 1000, SOCIAL },
@@ -101,8 +134,83 @@ void PerformanceManager::SelectProfile(LWOMAPID mapID) {
 
 uint32_t PerformanceManager::GetServerFrameDelta() {
 	if (UserManager::Instance()->GetUserCount() == 0) {
-		return m_InactiveProfile.serverFrameDelta;
+		return std::max(m_InactiveProfile.serverFrameDelta, GetFrameDeltaForLoadLevel(m_LoadLevel));
 	}
 
+	return GetFrameDeltaForLoadLevel(m_LoadLevel);
+}
+
+uint32_t PerformanceManager::GetSimulationStep() {
 	return m_CurrentProfile.serverFrameDelta;
 }
+
+void PerformanceManager::RecordFrame(const float workMs) {
+	m_AverageWorkMs += (workMs - m_AverageWorkMs) * averageWeight;
+
+	const auto frameDelta = static_cast<float>(GetServerFrameDelta());
+	if (m_AverageWorkMs > frameDelta * overloadedShare) {
+		m_FramesUnderBudget = 0;
+		if (++m_FramesOverBudget < framesToStepDown) return;
+
+		m_FramesOverBudget = 0;
+		if (!m_Overloaded) {
+			const auto* entities = Metrics::GetMetric(MetricVariable::UpdateEntities);
+			const auto* physics = Metrics::GetMetric(MetricVariable::Physics);
+			const auto* packets = Metrics::GetMetric(MetricVariable::PacketHandling);
+			const auto* replica = Metrics::GetMetric(MetricVariable::UpdateReplica);
+			LOG("Server is overloaded, frames take %.2fms of %.0fms (entities %.2fms, physics %.2fms, packets %.2fms, replica %.2fms) with %u players",
+				m_AverageWorkMs, frameDelta,
+				entities ? Metrics::ToMiliseconds(entities->average) : 0.0f,
+				physics ? Metrics::ToMiliseconds(physics->average) : 0.0f,
+				packets ? Metrics::ToMiliseconds(packets->average) : 0.0f,
+				replica ? Metrics::ToMiliseconds(replica->average) : 0.0f,
+				UserManager::Instance()->GetUserCount());
+		}
+		m_Overloaded = true;
+
+		SetLoadLevel(m_LoadLevel + 1);
+		return;
+	}
+
+	m_FramesOverBudget = 0;
+	if (!m_Overloaded && m_LoadLevel == 0) return;
+
+	// Only step up if the work would also fit the faster frame rate comfortably
+	const auto fasterFrameDelta = static_cast<float>(GetFrameDeltaForLoadLevel(m_LoadLevel == 0 ? 0 : m_LoadLevel - 1));
+	if (m_AverageWorkMs >= fasterFrameDelta * recoveredShare) {
+		m_FramesUnderBudget = 0;
+		return;
+	}
+
+	if (++m_FramesUnderBudget < framesToStepUp) return;
+	m_FramesUnderBudget = 0;
+
+	if (m_LoadLevel > 0) SetLoadLevel(m_LoadLevel - 1);
+	if (m_LoadLevel == 0 && m_Overloaded) {
+		m_Overloaded = false;
+		LOG("Server recovered from overload, frames take %.2fms", m_AverageWorkMs);
+	}
+}
+
+uint32_t PerformanceManager::GetFrameDeltaForLoadLevel(const uint32_t loadLevel) {
+	// Step down from the tier of the profile, never going faster than the profile
+	uint32_t tier = 0;
+	while (tier < frameDeltaTiers.size() - 1 && frameDeltaTiers[tier] < m_CurrentProfile.serverFrameDelta) tier++;
+
+	tier = std::min<uint32_t>(tier + loadLevel, frameDeltaTiers.size() - 1);
+	return std::max(frameDeltaTiers[tier], m_CurrentProfile.serverFrameDelta);
+}
+
+void PerformanceManager::SetLoadLevel(const uint32_t loadLevel) {
+	const auto previousFrameDelta = GetFrameDeltaForLoadLevel(m_LoadLevel);
+	m_LoadLevel = loadLevel;
+
+	const auto frameDelta = GetFrameDeltaForLoadLevel(m_LoadLevel);
+	if (frameDelta == previousFrameDelta) {
+		// Already at the slowest frame rate, there is no point in counting further
+		m_LoadLevel = loadLevel == 0 ? 0 : loadLevel - 1;
+		return;
+	}
+
+	LOG("Frame delta changed from %ums to %ums because of load", previousFrameDelta, frameDelta);
+}
@@ -8,15 +8,53 @@ struct PerformanceProfile {
 	uint32_t serverFrameDelta;
 };
 
+/**
+ * Picks the frame rate of the world server.
+ *
+ * The zone's profile sets the fastest frame rate, which is also the fixed step physics and entities are simulated with.
+ * When frames keep taking longer than the frame delta the server steps down to slower frame rates and reports itself
+ * as overloaded, so the world loop can defer work that is not needed every frame. Once the load drops it steps back up.
+ */
 class PerformanceManager {
 public:
 	static void SelectProfile(LWOMAPID mapID);
 
 	static uint32_t GetServerFrameDelta();
 
+	/**
+	 * The fixed step in milliseconds the simulation advances with while players are in the world,
+	 * independent of the current frame rate.
+	 */
+	static uint32_t GetSimulationStep();
+
+	/**
+	 * Records how long the work of a frame took, without the sleep at the end of the frame.
+	 *
+	 * @param workMs The time the frame spent working in milliseconds
+	 */
+	static void RecordFrame(const float workMs);
+
+	// Whether frames currently take longer than the frame delta allows, non-critical work should be deferred while this is true.
+	static bool IsOverloaded() { return m_Overloaded; }
+
 private:
+	static uint32_t GetFrameDeltaForLoadLevel(const uint32_t loadLevel);
+	static void SetLoadLevel(const uint32_t loadLevel);
+
 	static PerformanceProfile m_CurrentProfile;
 	static PerformanceProfile m_DefaultProfile;
 	static PerformanceProfile m_InactiveProfile;
 	static std::map<LWOMAPID, PerformanceProfile> m_Profiles;
+
+	// Running average of the frame work time in milliseconds
+	static float m_AverageWorkMs;
+
+	// How many frame rate tiers below the profile the server is running at
+	static uint32_t m_LoadLevel;
+
+	// Frames the current load has been seen in a row, to not switch frame rates on a single slow or fast frame
+	static uint32_t m_FramesOverBudget;
+	static uint32_t m_FramesUnderBudget;
+
+	static bool m_Overloaded;
 };
@@ -3,12 +3,17 @@
 #include <ctime>
 #include <chrono>
 #include <thread>
+#include <filesystem>
+#include <fstream>
+#include <cmath>
+#include <algorithm>
 
 #include "MD5.h"
 
 //DLU Includes:
 #include "dCommonVars.h"
 #include "dServer.h"
+#include "ClientPacketQueue.h"
 #include "Logger.h"
 #include "Database.h"
 #include "dConfig.h"
@@ -103,6 +108,7 @@ void WorldShutdownSequence();
 void WorldShutdownProcess(uint32_t zoneId);
 void FinalizeShutdown();
 void SendShutdownMessageToMaster();
+void WriteBenchmarkMetrics(const std::filesystem::path& directory, uint32_t zoneID, uint32_t frameDelta);
 
 void HandlePacketChat(Packet* packet);
 void HandleMasterPacket(Packet* packet);
@@ -148,6 +154,8 @@ int main(int argc, char** argv) {
 	Game::config = new dConfig("worldconfig.ini");
 
 	//Create all the objects we need to run our service:
+	// Writes out everything logged before any return from main, including the early ones on failure
+	const Server::LoggerGuard loggerGuard;
 	Server::SetupLogger("WorldServer_" + std::to_string(zoneID) + "_" + std::to_string(instanceID));
 	if (!Game::logger) return EXIT_FAILURE;
 
@@ -240,6 +248,18 @@ int main(int argc, char** argv) {
 
 	const float maxPacketProcessingTime = 1.5f; //0.015f;
 	const uint32_t maxPacketsToProcess = 1024;
+	const uint32_t maxPacketsToReceive = 4 * maxPacketsToProcess;
+
+	// Client packets are handed out round-robin per client, so a single client can't starve the others
+	const auto packetRateWarning = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("client_packet_rate_warning")).value_or(300);
+	ClientPacketQueue clientPackets(packetRateWarning);
+
+	// Frame time percentiles are written here for load tests, nothing is written if this is empty
+	std::filesystem::path benchmarkMetricsDir;
+	if (!Game::config->GetValue("benchmark_metrics_dir").empty()) {
+		benchmarkMetricsDir = BinaryPathFinder::GetBinaryDir() / Game::config->GetValue("benchmark_metrics_dir");
+		std::filesystem::create_directories(benchmarkMetricsDir);
+	}
 
 	bool ready = false;
 	uint32_t framesSinceMasterStatus = 0;
@@ -249,6 +269,19 @@ int main(int argc, char** argv) {
 	uint32_t ghostingStepCount = 0;
 	auto ghostingLastTime = std::chrono::high_resolution_clock::now();
 
+	// While players are in the world the simulation advances in fixed steps, no matter how fast frames run.
+	// Frames that fall behind catch up by running more than one step, but never more than this many in a frame,
+	// unless a frame on time at the current load tier already needs more.
+	const auto maxSimulationStepsPerFrame = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("max_simulation_steps_per_frame")).value_or(3);
+	float simulationTimeToStep = 0.0f;
+
+	// Work that can wait a little is deferred while the server is overloaded
+	const auto overloadedGhostingInterval = GeneralUtils::TryParse<float>(Game::config->GetValue("overloaded_ghosting_interval")).value_or(3.0f);
+	const uint32_t overloadedSpawnerInterval = 4; // frames
+	const uint32_t maxDeferredSaveTime = 2 * 60; // seconds
+	float spawnerDeltaTime = 0.0f;
+	uint32_t framesSinceSpawnerUpdate = 0;
+
 	PerformanceManager::SelectProfile(zoneID);
 
 	Game::entityManager = new EntityManager();
@@ -357,11 +390,6 @@ int main(int argc, char** argv) {
 			framesSinceLastUser *= ratioBeforeToAfter;
 		}
 
-		//Warning if we ran slow
-		if (deltaTime > currentFrameDelta) {
-			LOG("We're running behind, dT: %f > %f (framerate %i)", deltaTime, currentFrameDelta, currentFramerate);
-		}
-
 		//Check if we're still connected to master:
 		if (!Game::server->GetIsConnectedToMaster()) {
 			framesSinceMasterDisconnect++;
@@ -385,24 +413,55 @@ int main(int argc, char** argv) {
 
 		//In world we'd update our other systems here.
 
+		const auto overloaded = PerformanceManager::IsOverloaded();
+
 		if (zoneID != 0 && deltaTime > 0.0f) {
-			Metrics::StartMeasurement(MetricVariable::UpdateEntities);
-			Game::entityManager->UpdateEntities(deltaTime);
-			Metrics::EndMeasurement(MetricVariable::UpdateEntities);
+			// Run the simulation in fixed steps while players are around, so a slower frame rate does not change how the game plays
+			float simulationStep = deltaTime;
+			uint32_t simulationSteps = 1;
+			if (ready && occupied) {
+				simulationStep = PerformanceManager::GetSimulationStep() / 1000.0f;
+				simulationTimeToStep += deltaTime;
+				simulationSteps = static_cast<uint32_t>(simulationTimeToStep / simulationStep);
+				// Never cap below the steps the current frame delta needs, or the zone would run slower than real time
+				const auto stepsPerFrame = static_cast<uint32_t>(std::ceil(currentFrameDelta / 1000.0f / simulationStep));
+				const auto maxSteps = std::max(maxSimulationStepsPerFrame, stepsPerFrame);
+				if (simulationSteps > maxSteps) {
+					// Too far behind to catch up, drop the time we can't simulate instead of falling further behind
+					simulationSteps = maxSteps;
+					simulationTimeToStep = simulationStep * simulationSteps;
+				}
+				simulationTimeToStep -= simulationStep * simulationSteps;
+			} else {
+				// Start with half a step to spare so the first occupied frames don't jitter between zero and two steps
+				simulationTimeToStep = PerformanceManager::GetSimulationStep() / 2000.0f;
+			}
 
-			Metrics::StartMeasurement(MetricVariable::Physics);
-			dpWorld::StepWorld(deltaTime);
-			Metrics::EndMeasurement(MetricVariable::Physics);
+			for (uint32_t step = 0; step < simulationSteps; step++) {
+				Metrics::StartMeasurement(MetricVariable::UpdateEntities);
+				Game::entityManager->UpdateEntities(simulationStep);
+				Metrics::EndMeasurement(MetricVariable::UpdateEntities);
+
+				Metrics::StartMeasurement(MetricVariable::Physics);
+				dpWorld::StepWorld(simulationStep);
+				Metrics::EndMeasurement(MetricVariable::Physics);
+			}
 
 			Metrics::StartMeasurement(MetricVariable::Ghosting);
-			if (std::chrono::duration<float>(currentTime - ghostingLastTime).count() >= 1.0f) {
+			const auto ghostingInterval = overloaded ? overloadedGhostingInterval : 1.0f;
+			if (std::chrono::duration<float>(currentTime - ghostingLastTime).count() >= ghostingInterval) {
 				Game::entityManager->UpdateGhosting();
 				ghostingLastTime = currentTime;
 			}
 			Metrics::EndMeasurement(MetricVariable::Ghosting);
 
 			Metrics::StartMeasurement(MetricVariable::UpdateSpawners);
-			Game::zoneManager->Update(deltaTime);
+			spawnerDeltaTime += simulationStep * simulationSteps;
+			if (!overloaded || ++framesSinceSpawnerUpdate >= overloadedSpawnerInterval) {
+				Game::zoneManager->Update(spawnerDeltaTime);
+				spawnerDeltaTime = 0.0f;
+				framesSinceSpawnerUpdate = 0;
+			}
 			Metrics::EndMeasurement(MetricVariable::UpdateSpawners);
 		}
 
@@ -428,8 +487,9 @@ int main(int argc, char** argv) {
 		UserManager::Instance()->DeletePendingRemovals();
 
 		auto t1 = std::chrono::high_resolution_clock::now();
+		clientPackets.ReceiveFrom(Game::server, maxPacketsToReceive);
 		for (uint32_t curPacket = 0; curPacket < maxPacketsToProcess && timeSpent < maxPacketProcessingTime; curPacket++) {
-			packet = Game::server->Receive();
+			packet = clientPackets.Pop();
 			if (packet) {
 				auto t1 = std::chrono::high_resolution_clock::now();
 				HandlePacket(packet);
@@ -443,10 +503,21 @@ int main(int argc, char** argv) {
 			}
 		}
 
+		// Apply the latest position of every player once per frame, even on frames without a simulation step
+		Game::entityManager->ApplyPositionUpdates();
+
 		Metrics::EndMeasurement(MetricVariable::PacketHandling);
 
+		// Constructions for players loading in are spread over several frames
+		Metrics::StartMeasurement(MetricVariable::EntityConstruction);
+		Game::entityManager->SendQueuedConstructions();
+		Metrics::EndMeasurement(MetricVariable::EntityConstruction);
+
 		Metrics::StartMeasurement(MetricVariable::UpdateReplica);
 
+		// Send everything that was queued for individual clients this frame:
+		Game::server->FlushQueuedSends();
+
 		//Update our replica objects:
 		Game::server->UpdateReplica();
 
@@ -455,6 +526,7 @@ int main(int argc, char** argv) {
 		//Push our log every 15s:
 		if (framesSinceLastFlush >= logFlushTime) {
 			Game::logger->Flush();
+			if (!benchmarkMetricsDir.empty()) WriteBenchmarkMetrics(benchmarkMetricsDir, zoneID, currentFrameDelta);
 			framesSinceLastFlush = 0;
 		} else framesSinceLastFlush++;
 
@@ -469,8 +541,9 @@ int main(int argc, char** argv) {
 			framesSinceLastUser = 0;
 		}
 
-		//Save all connected users every 10 minutes:
-		if (framesSinceLastUsersSave >= saveTime && zoneID != 0) {
+		//Save all connected users every 10 minutes, or up to 2 minutes later if the server is overloaded:
+		const auto deferSave = overloaded && framesSinceLastUsersSave < saveTime + maxDeferredSaveTime * currentFramerate;
+		if (framesSinceLastUsersSave >= saveTime && zoneID != 0 && !deferSave) {
 			UserManager::Instance()->SaveAllActiveCharacters();
 			framesSinceLastUsersSave = 0;
 
@@ -495,6 +568,11 @@ int main(int argc, char** argv) {
 
 		Metrics::EndMeasurement(MetricVariable::GameLoop);
 
+		if (ready) {
+			const auto workTime = std::chrono::high_resolution_clock::now() - currentTime;
+			PerformanceManager::RecordFrame(std::chrono::duration<float, std::milli>(workTime).count());
+		}
+
 		Metrics::StartMeasurement(MetricVariable::Sleep);
 
 		t += std::chrono::milliseconds(currentFrameDelta);
@@ -524,6 +602,7 @@ int main(int argc, char** argv) {
 		Metrics::AddMeasurement(MetricVariable::CPUTime, (1e6 * (1000.0 * (std::clock() - metricCPUTimeStart))) / CLOCKS_PER_SEC);
 		Metrics::EndMeasurement(MetricVariable::Frame);
 	}
+	clientPackets.Clear(Game::server);
 	FinalizeShutdown();
 	return EXIT_SUCCESS;
 }
@@ -664,13 +743,13 @@ void HandleMasterPacket(Packet* packet) {
 	if (packet->length < 2) return;
 	if (static_cast<eConnectionType>(packet->data[1]) != eConnectionType::MASTER || packet->length < 4) return;
 	switch (static_cast<eMasterMessageType>(packet->data[3])) {
-	case eMasterMessageType::REQUEST_PERSISTENT_ID_RESPONSE: {
+	case eMasterMessageType::REQUEST_PERSISTENT_ID_BLOCK_RESPONSE: {
 		CINSTREAM_SKIP_HEADER;
-		uint64_t requestID;
-		inStream.Read(requestID);
-		uint32_t objectID;
-		inStream.Read(objectID);
-		ObjectIDManager::HandleRequestPersistentIDResponse(requestID, objectID);
+		uint32_t firstID = 0;
+		inStream.Read(firstID);
+		uint32_t count = 0;
+		inStream.Read(count);
+		ObjectIDManager::HandlePersistentIDBlock(firstID, count);
 		break;
 	}
 
@@ -775,7 +854,7 @@ void HandleMasterPacket(Packet* packet) {
 
 		//Check the key:
 		if (sessionKey != std::atoi(user->GetSessionKey().c_str())) {
-			LOG("But the session key is invalid!", username.string.c_str());
+			LOG("But the session key is invalid for %s!", username.string.c_str());
 			Game::server->Disconnect(user->GetSystemAddress(), eServerDisconnectIdentifiers::INVALID_SESSION_KEY);
 			return;
 		}
@@ -1015,7 +1094,10 @@ void HandlePacket(Packet* packet) {
 		User* user = UserManager::Instance()->GetUser(packet->systemAddress);
 		if (user) {
 			Character* c = user->GetLastUsedChar();
-			if (c != nullptr) {
+			if (c != nullptr && c->GetXmlLoadFailed()) {
+				LOG("Character %s (%i) could not be loaded, disconnecting user %s", c->GetName().c_str(), c->GetID(), user->GetUsername().c_str());
+				Game::server->Disconnect(packet->systemAddress, eServerDisconnectIdentifiers::CHARACTER_CORRUPTED);
+			} else if (c != nullptr) {
 				std::u16string username = GeneralUtils::ASCIIToUTF16(c->GetName());
 				Game::server->GetReplicaManager()->AddParticipant(packet->systemAddress);
 
@@ -1120,9 +1202,8 @@ void HandlePacket(Packet* packet) {
 
 			noBBB:
 
-				// Tell the client it's done loading:
+				// The client is told it's done loading once all its queued constructions are sent
 				GameMessages::SendInvalidZoneTransferList(player, packet->systemAddress, GeneralUtils::ASCIIToUTF16(Game::config->GetValue("source")), u"", false, false);
-				GameMessages::SendServerDoneLoadingAllObjects(player, packet->systemAddress);
 
 				//Send the player it's mail count:
 				//update: this might not be needed so im going to try disabling this here.
@@ -1170,8 +1251,9 @@ void HandlePacket(Packet* packet) {
 			return;
 		}
 
+		// Only the latest update of the frame is applied, see EntityManager::ApplyPositionUpdates
 		Entity* entity = Game::entityManager->GetEntity(user->GetLastUsedChar()->GetObjectID());
-		if (entity) entity->ProcessPositionUpdate(positionUpdate);
+		Game::entityManager->QueuePositionUpdate(entity, positionUpdate);
 		break;
 	}
 
@@ -1461,6 +1543,39 @@ void FinalizeShutdown() {
 	exit(EXIT_SUCCESS);
 }
 
+void WriteBenchmarkMetrics(const std::filesystem::path& directory, uint32_t zoneID, uint32_t frameDelta) {
+	const auto fileName = "world_" + std::to_string(zoneID) + "_" + std::to_string(instanceID) + "_" + std::to_string(g_CloneID) + ".jsonl";
+	std::ofstream file(directory / fileName, std::ios::app);
+	if (!file) {
+		LOG("Failed to open benchmark metrics file %s", (directory / fileName).string().c_str());
+		return;
+	}
+
+	// One JSON object per line, times in milliseconds
+	file << "{\"time\":" << std::time(nullptr)
+		<< ",\"zone\":" << zoneID
+		<< ",\"instance\":" << instanceID
+		<< ",\"clone\":" << g_CloneID
+		<< ",\"players\":" << UserManager::Instance()->GetUserCount()
+		<< ",\"frame_delta\":" << frameDelta
+		<< ",\"overloaded\":" << (PerformanceManager::IsOverloaded() ? "true" : "false")
+		<< ",\"rss\":" << Metrics::GetCurrentRSS()
+		<< ",\"queued_constructions\":" << Game::entityManager->GetQueuedConstructions();
+
+	for (const auto variable : { MetricVariable::Frame, MetricVariable::GameLoop, MetricVariable::PacketHandling, MetricVariable::UpdateEntities, MetricVariable::Physics, MetricVariable::EntityConstruction, MetricVariable::UpdateReplica }) {
+		if (Metrics::GetMetric(variable) == nullptr) continue;
+
+		file << ",\"" << Metrics::MetricVariableToString(variable) << "\":{"
+			<< "\"p50\":" << Metrics::ToMiliseconds(Metrics::GetPercentile(variable, 0.5f))
+			<< ",\"p95\":" << Metrics::ToMiliseconds(Metrics::GetPercentile(variable, 0.95f))
+			<< ",\"p99\":" << Metrics::ToMiliseconds(Metrics::GetPercentile(variable, 0.99f))
+			<< ",\"max\":" << Metrics::ToMiliseconds(Metrics::GetPercentile(variable, 1.0f))
+			<< "}";
+	}
+
+	file << "}\n";
+}
+
 void SendShutdownMessageToMaster() {
 	CBITSTREAM;
 	BitStreamUtils::WriteHeader(bitStream, eConnectionType::MASTER, eMasterMessageType::SHUTDOWN_RESPONSE);
@@ -206,21 +206,10 @@ void Level::ReadSceneObjectDataChunk(std::istream& file, Header& header) {
 	uint32_t objectsCount = 0;
 	BinaryIO::BinaryRead(file, objectsCount);
 
-	CDFeatureGatingTable* featureGatingTable = CDClientManager::GetTable<CDFeatureGatingTable>();
-
-	CDFeatureGating gating;
-	gating.major =
-		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_major")).value_or(ClientVersion::major);
-	gating.current =
-		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_current")).value_or(ClientVersion::current);
-	gating.minor =
-		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_minor")).value_or(ClientVersion::minor);
-
-	const auto zoneControlObject = Game::zoneManager->GetZoneControlObject();
-	DluAssert(zoneControlObject != nullptr);
+	m_SceneObjects.reserve(m_SceneObjects.size() + objectsCount);
 	for (uint32_t i = 0; i < objectsCount; ++i) {
 		std::u16string ldfString;
-		SceneObject obj;
+		SceneObject& obj = m_SceneObjects.emplace_back();
 		BinaryIO::BinaryRead(file, obj.id);
 		BinaryIO::BinaryRead(file, obj.lot);
 
@@ -233,13 +222,6 @@ void Level::ReadSceneObjectDataChunk(std::istream& file, Header& header) {
 		BinaryIO::ReadString<uint32_t>(file, ldfString);
 		BinaryIO::BinaryRead(file, obj.value3);
 
-		//This is a little bit of a bodge, but because the alpha client (HF) doesn't store the
-		//spawn position / rotation like the later versions do, we need to check the LOT for the spawn pos & set it.
-		if (obj.lot == LOT_MARKER_PLAYER_START) {
-			Game::zoneManager->GetZone()->SetSpawnPos(obj.position);
-			Game::zoneManager->GetZone()->SetSpawnRot(obj.rotation);
-		}
-
 		std::string sData = GeneralUtils::UTF16ToWTF8(ldfString);
 		std::stringstream ssData(sData);
 		std::string token;
@@ -249,7 +231,29 @@ void Level::ReadSceneObjectDataChunk(std::istream& file, Header& header) {
 			LDFBaseData* ldfData = LDFBaseData::DataFromString(token);
 			obj.settings.push_back(ldfData);
 		}
+	}
+}
+
+void Level::LoadObjects() {
+	CDFeatureGatingTable* featureGatingTable = CDClientManager::GetTable<CDFeatureGatingTable>();
+
+	CDFeatureGating gating;
+	gating.major =
+		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_major")).value_or(ClientVersion::major);
+	gating.current =
+		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_current")).value_or(ClientVersion::current);
+	gating.minor =
+		GeneralUtils::TryParse<int32_t>(Game::config->GetValue("version_minor")).value_or(ClientVersion::minor);
 
+	const auto zoneControlObject = Game::zoneManager->GetZoneControlObject();
+	DluAssert(zoneControlObject != nullptr);
+	for (auto& obj : m_SceneObjects) {
+		//This is a little bit of a bodge, but because the alpha client (HF) doesn't store the
+		//spawn position / rotation like the later versions do, we need to check the LOT for the spawn pos & set it.
+		if (obj.lot == LOT_MARKER_PLAYER_START) {
+			Game::zoneManager->GetZone()->SetSpawnPos(obj.position);
+			Game::zoneManager->GetZone()->SetSpawnRot(obj.rotation);
+		}
 
 		// We should never have more than 1 zone control object
 		bool skipLoadingObject = obj.lot == zoneControlObject->GetLOT();
@@ -301,4 +305,6 @@ void Level::ReadSceneObjectDataChunk(std::istream& file, Header& header) {
 			Game::entityManager->CreateEntity(info);
 		}
 	}
+
+	m_SceneObjects.clear();
 }
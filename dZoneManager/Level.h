@@ -38,14 +38,26 @@ public:
 	};
 
 public:
+	/**
+	 * Reads the level file, the objects in it are only created by LoadObjects.
+	 * Touches no game state, so levels can be read on any thread.
+	 */
 	Level(Zone* parentZone, const std::string& filepath);
 	
 	static void MakeSpawner(SceneObject obj);
 
+	/**
+	 * Creates the spawners and entities of the objects read from the level file, has to run on the main thread.
+	 */
+	void LoadObjects();
+
 	std::map<uint32_t, Header> m_ChunkHeaders;
 private:
 	Zone* m_ParentZone;
 
+	// The objects read from the level file that were not created yet
+	std::vector<SceneObject> m_SceneObjects;
+
 	//private functions:
 	void ReadChunks(std::istream& file);
 	void ReadFileInfoChunk(std::istream& file, Header& header);
@@ -19,6 +19,13 @@
 #include "eTriggerEventType.h"
 #include "eWaypointCommandType.h"
 #include "dNavMesh.h"
+#include "dConfig.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
 
 Zone::Zone(const LWOMAPID& mapID, const LWOINSTANCEID& instanceID, const LWOCLONEID& cloneID) :
 	m_ZoneID(mapID, instanceID, cloneID) {
@@ -37,9 +44,19 @@ Zone::~Zone() {
 }
 
 void Zone::Initalize() {
+	auto start = std::chrono::steady_clock::now();
 	LoadZoneIntoMemory();
+	// Scene parsing happens inside of reading the zone file, leave it out of the zone file time
+	m_LoadTimings.zoneFile = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count() - m_LoadTimings.sceneParsing;
+
+	start = std::chrono::steady_clock::now();
 	LoadLevelsIntoMemory();
+	m_LoadTimings.objectCreation = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
 	m_CheckSum = CalculateChecksum();
+
+	LOG("Zone %i loaded: zone file %.1f ms, %zu scenes parsed on %u threads in %.1f ms, objects created in %.1f ms",
+		m_ZoneID.GetMapID(), m_LoadTimings.zoneFile, m_Scenes.size(), m_LoadTimings.sceneThreads, m_LoadTimings.sceneParsing, m_LoadTimings.objectCreation);
 }
 
 void Zone::LoadZoneIntoMemory() {
@@ -80,6 +97,9 @@ void Zone::LoadZoneIntoMemory() {
 			LoadScene(file);
 		}
 
+		// Triggers have to be loaded before the path spawners below spawn anything
+		ParseScenes();
+
 		//Read generic zone info:
 		BinaryIO::ReadString<uint8_t>(file, m_ZonePath, BinaryIO::ReadType::String);
 		BinaryIO::ReadString<uint8_t>(file, m_ZoneRawPath, BinaryIO::ReadType::String);
@@ -191,9 +211,10 @@ uint32_t Zone::CalculateChecksum() {
 }
 
 void Zone::LoadLevelsIntoMemory() {
+	// Objects are created in scene order so every boot creates them the same way
 	for (auto& [sceneID, scene] : m_Scenes) {
-		if (scene.level) continue;
-		scene.level = new Level(this, m_ZonePath + scene.filename);
+		if (!scene.level) continue;
+		scene.level->LoadObjects();
 
 		if (scene.level->m_ChunkHeaders.empty()) continue;
 
@@ -215,9 +236,6 @@ void Zone::LoadScene(std::istream& file) {
 
 	BinaryIO::ReadString<uint8_t>(file, scene.filename, BinaryIO::ReadType::String);
 
-	std::string luTriggersPath = scene.filename.substr(0, scene.filename.size() - 4) + ".lutriggers";
-	if (Game::assetManager->HasFile((m_ZonePath + luTriggersPath).c_str())) LoadLUTriggers(luTriggersPath, scene);
-
 	if (m_FileFormatVersion >= Zone::FileFormatVersion::LatePreAlpha || m_FileFormatVersion < Zone::FileFormatVersion::PrePreAlpha) {
 		BinaryIO::BinaryRead(file, scene.id);
 		lwoSceneID.SetSceneID(scene.id);
@@ -243,6 +261,53 @@ void Zone::LoadScene(std::istream& file) {
 	m_Scenes.insert(std::make_pair(lwoSceneID, scene));
 }
 
+void Zone::ParseScenes() {
+	const auto start = std::chrono::steady_clock::now();
+
+	std::vector<SceneRef*> scenes;
+	scenes.reserve(m_Scenes.size());
+	for (auto& [sceneID, scene] : m_Scenes) {
+		if (!scene.level) scenes.push_back(&scene);
+	}
+
+	uint32_t threadCount = GeneralUtils::TryParse<uint32_t>(Game::config->GetValue("zone_load_threads")).value_or(0);
+	if (threadCount == 0) threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+	threadCount = std::clamp<uint32_t>(threadCount, 1, std::max<size_t>(scenes.size(), 1));
+
+	// Every thread takes the next scene nobody took yet, a scene is only ever touched by one thread
+	std::atomic<size_t> nextScene = 0;
+	std::mutex errorMutex;
+	std::exception_ptr error;
+	const auto parse = [this, &scenes, &nextScene, &errorMutex, &error]() {
+		for (size_t i = nextScene++; i < scenes.size(); i = nextScene++) {
+			try {
+				ParseScene(*scenes[i]);
+			} catch (...) {
+				std::lock_guard lock(errorMutex);
+				if (!error) error = std::current_exception();
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+	for (uint32_t i = 1; i < threadCount; i++) threads.emplace_back(parse);
+	parse();
+	for (auto& thread : threads) thread.join();
+
+	m_LoadTimings.sceneThreads = threadCount;
+	m_LoadTimings.sceneParsing = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	if (error) std::rethrow_exception(error);
+}
+
+void Zone::ParseScene(SceneRef& scene) {
+	std::string luTriggersPath = scene.filename.substr(0, scene.filename.size() - 4) + ".lutriggers";
+	if (Game::assetManager->HasFile((m_ZonePath + luTriggersPath).c_str())) LoadLUTriggers(luTriggersPath, scene);
+
+	scene.level = new Level(this, m_ZonePath + scene.filename);
+}
+
 void Zone::LoadLUTriggers(std::string triggerFile, SceneRef& scene) {
 	auto file = Game::assetManager->GetFile((m_ZonePath + triggerFile).c_str());
 
@@ -202,6 +202,14 @@ public:
 		Latest = 41
 	};
 
+	// How long each phase of loading the zone took, in milliseconds
+	struct LoadTimings {
+		float zoneFile = 0.0f;
+		float sceneParsing = 0.0f;
+		float objectCreation = 0.0f;
+		uint32_t sceneThreads = 0;
+	};
+
 public:
 	Zone(const LWOMAPID& mapID, const LWOINSTANCEID& instanceID, const LWOCLONEID& cloneID);
 	~Zone();
@@ -228,6 +236,8 @@ public:
 	void SetSpawnPos(const NiPoint3& pos) { m_Spawnpoint = pos; }
 	void SetSpawnRot(const NiQuaternion& rot) { m_SpawnpointRotation = rot; }
 
+	const LoadTimings& GetLoadTimings() const { return m_LoadTimings; }
+
 private:
 	LWOZONEID m_ZoneID;
 	std::string m_ZoneFilePath;
@@ -253,8 +263,16 @@ private:
 	std::vector<Path> m_Paths;
 
 	std::map<LWOSCENEID, uint32_t> m_MapRevisions; //rhs is the revision!
+	LoadTimings m_LoadTimings;
 	//private ("helper") functions:
 	void LoadScene(std::istream& file);
+
+	/**
+	 * Reads the level files and triggers of every scene on a pool of threads, set by zone_load_threads.
+	 * The objects in the levels are created later on the main thread by LoadLevelsIntoMemory.
+	 */
+	void ParseScenes();
+	void ParseScene(SceneRef& scene);
 	void LoadLUTriggers(std::string triggerFile, SceneRef& scene);
 	void LoadSceneTransition(std::istream& file);
 	SceneTransitionInfo LoadSceneTransitionInfo(std::istream& file);
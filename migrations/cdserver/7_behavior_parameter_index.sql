@@ -0,0 +1 @@
+CREATE INDEX IF NOT EXISTS BehaviorParameter_behaviorID ON BehaviorParameter (behaviorID);
@@ -0,0 +1,16 @@
+CREATE TABLE IF NOT EXISTS charsummary (
+	id BIGINT NOT NULL PRIMARY KEY REFERENCES charinfo(id) ON DELETE CASCADE,
+	hair_color INT UNSIGNED NOT NULL DEFAULT 0,
+	hair_style INT UNSIGNED NOT NULL DEFAULT 0,
+	shirt_color INT UNSIGNED NOT NULL DEFAULT 0,
+	pants_color INT UNSIGNED NOT NULL DEFAULT 0,
+	left_hand INT UNSIGNED NOT NULL DEFAULT 0,
+	right_hand INT UNSIGNED NOT NULL DEFAULT 0,
+	eyebrows INT UNSIGNED NOT NULL DEFAULT 0,
+	eyes INT UNSIGNED NOT NULL DEFAULT 0,
+	mouth INT UNSIGNED NOT NULL DEFAULT 0,
+	zone_id INT UNSIGNED NOT NULL DEFAULT 0,
+	zone_instance INT UNSIGNED NOT NULL DEFAULT 0,
+	zone_clone INT UNSIGNED NOT NULL DEFAULT 0,
+	equipped_items TEXT NOT NULL
+);
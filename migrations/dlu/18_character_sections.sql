@@ -0,0 +1,6 @@
+CREATE TABLE IF NOT EXISTS charsections (
+	id BIGINT NOT NULL REFERENCES charinfo(id) ON DELETE CASCADE,
+	section VARCHAR(32) NOT NULL,
+	data MEDIUMBLOB NOT NULL,
+	PRIMARY KEY (id, section)
+);
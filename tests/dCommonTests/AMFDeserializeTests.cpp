@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "AMFDeserialize.h"
+#include "AMFReader.h"
 #include "Amf3.h"
 
 #include "Game.h"
@@ -437,3 +438,98 @@ args: amf3!
 	],
 }
  */
+
+/**
+ * @brief Test reading an AMFArray into an arena gives the same values as reading it on its own
+ */
+TEST(dCommonTests, AMFDeserializeArenaTest) {
+	std::ifstream testFileStream;
+	testFileStream.open("AMFBitStreamTest.bin", std::ios::binary);
+
+	RakNet::BitStream testBitStream;
+	char byte = 0;
+	while (testFileStream.get(byte)) {
+		testBitStream.Write<char>(byte);
+	}
+
+	testFileStream.close();
+
+	AMFArena arena;
+	AMFDeserialize deserializer;
+	auto* result = static_cast<AMFArrayValue*>(deserializer.Read(testBitStream, arena));
+	ASSERT_EQ(result->GetValueType(), eAmf::Array);
+	ASSERT_EQ(result->Get<std::string>("BehaviorID")->GetValue(), "10447");
+	ASSERT_EQ(result->Get<std::string>("objectID")->GetValue(), "288300744895913279");
+
+	auto* executionState = result->GetArray("executionState");
+	ASSERT_NE(executionState, nullptr);
+	ASSERT_EQ(executionState->GetArray("strips")->GetDense().size(), 1);
+
+	// Arrays of an arena create their elements in the arena
+	auto* inserted = result->InsertArray("inserted");
+	ASSERT_NE(inserted, nullptr);
+	inserted->Insert("value", 5.0);
+	ASSERT_EQ(result->GetArray("inserted")->Get<double>("value")->GetValue(), 5.0);
+	result->Remove("inserted");
+	ASSERT_EQ(result->GetArray("inserted"), nullptr);
+
+	arena.Reset();
+	auto* reused = arena.Create<AMFArrayValue>(arena);
+	reused->Insert("key", std::string("value"));
+	ASSERT_EQ(reused->Get<std::string>("key")->GetValue(), "value");
+}
+
+/**
+ * @brief Test reading values one at a time with a reader, including strings by reference and strings that are not byte aligned
+ */
+TEST(dCommonTests, AMFReaderTest) {
+	CBITSTREAM;
+	bitStream.Write0();
+	// An array with one associative and one dense value
+	bitStream.Write<uint8_t>(0x09);
+	bitStream.Write<uint8_t>(0x03);
+	bitStream.Write<uint8_t>(0x07);
+	for (const auto character : std::string("key")) bitStream.Write<char>(character);
+	bitStream.Write<uint8_t>(0x06);
+	bitStream.Write<uint8_t>(0x0B);
+	for (const auto character : std::string("value")) bitStream.Write<char>(character);
+	bitStream.Write<uint8_t>(0x01);
+	// The dense value refers to the first string read
+	bitStream.Write<uint8_t>(0x06);
+	bitStream.Write<uint8_t>(0x00);
+
+	bool padding = true;
+	bitStream.Read(padding);
+	ASSERT_FALSE(padding);
+
+	AMFReader reader(bitStream);
+	ASSERT_EQ(reader.ReadMarker(), eAmf::Array);
+	ASSERT_EQ(reader.ReadArrayStart(), 1);
+	ASSERT_EQ(reader.ReadKey(), "key");
+	ASSERT_EQ(reader.ReadMarker(), eAmf::String);
+	ASSERT_EQ(reader.ReadString(), "value");
+	ASSERT_TRUE(reader.ReadKey().empty());
+	ASSERT_EQ(reader.ReadMarker(), eAmf::String);
+	ASSERT_EQ(reader.ReadString(), "key");
+	ASSERT_EQ(bitStream.GetNumberOfUnreadBits(), 0);
+
+	// Byte aligned strings are viewed in place
+	RakNet::BitStream alignedStream;
+	alignedStream.Write<uint8_t>(0x09);
+	alignedStream.Write<uint8_t>(0x01);
+	alignedStream.Write<uint8_t>(0x07);
+	for (const auto character : std::string("key")) alignedStream.Write<char>(character);
+	alignedStream.Write<uint8_t>(0x04);
+	alignedStream.Write<uint8_t>(0x05);
+	alignedStream.Write<uint8_t>(0x01);
+	alignedStream.Write<uint8_t>(0x06);
+	alignedStream.Write<uint8_t>(0x00);
+
+	AMFReader alignedReader(alignedStream);
+	alignedReader.Skip(alignedReader.ReadMarker());
+	ASSERT_EQ(alignedStream.GetNumberOfUnreadBits(), 16);
+	ASSERT_EQ(alignedReader.ReadMarker(), eAmf::String);
+	const auto key = alignedReader.ReadString();
+	ASSERT_EQ(key, "key");
+	ASSERT_EQ(key.data(), reinterpret_cast<const char*>(alignedStream.GetData()) + 3);
+}
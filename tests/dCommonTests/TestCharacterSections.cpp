@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "CharacterSections.h"
+#include "tinyxml2.h"
+
+namespace {
+	const std::string characterXml =
+		"<obj v=\"1\"><mf hc=\"1\"/><char cc=\"10\" gm=\"0\"/><inv><items><in t=\"0\"><i l=\"4106\" s=\"0\"/></in></items></inv>"
+		"<flag><f id=\"1\" v=\"2\"/></flag><lvl l=\"5\"/><mis><done/><cur/></mis></obj>";
+}
+
+TEST(dCommonTests, CharacterSectionsEncodeDecodeTest) {
+	const std::string sectionXml = "<inv><items><in t=\"0\"><i l=\"4106\" s=\"0\"/></in></items></inv>";
+	const auto encoded = CharacterSections::Encode(sectionXml);
+	ASSERT_TRUE(encoded.has_value());
+	ASSERT_NE(*encoded, sectionXml);
+
+	const auto decoded = CharacterSections::Decode(*encoded);
+	ASSERT_TRUE(decoded.has_value());
+	ASSERT_EQ(*decoded, sectionXml);
+
+	ASSERT_FALSE(CharacterSections::Decode(sectionXml).has_value());
+	ASSERT_FALSE(CharacterSections::Decode("").has_value());
+}
+
+TEST(dCommonTests, CharacterSectionsDecodeSizeLimitTest) {
+	auto encoded = *CharacterSections::Encode("<flag><f id=\"1\" v=\"2\"/></flag>");
+
+	// A header claiming far more data than the compressed bytes can hold must not be allocated
+	const uint32_t hugeSize = CharacterSections::MAX_SECTION_SIZE - 1;
+	std::memcpy(encoded.data() + sizeof(uint32_t) + sizeof(uint8_t), &hugeSize, sizeof(hugeSize));
+	ASSERT_FALSE(CharacterSections::Decode(encoded).has_value());
+}
+
+TEST(dCommonTests, CharacterSectionsSplitJoinTest) {
+	tinyxml2::XMLDocument doc;
+	ASSERT_EQ(doc.Parse(characterXml.c_str(), characterXml.size()), tinyxml2::XML_SUCCESS);
+
+	const auto sections = CharacterSections::Split(doc);
+	ASSERT_EQ(sections.size(), 7);
+	ASSERT_TRUE(sections.contains(std::string(CharacterSections::ROOT_SECTION)));
+	ASSERT_EQ(sections.at("flag"), "<flag><f id=\"1\" v=\"2\"/></flag>");
+
+	// The top level elements keep their order, not the order of the section names
+	ASSERT_EQ(CharacterSections::Join(sections), characterXml);
+}
+
+TEST(dCommonTests, CharacterSectionsJoinWithoutPlaceholdersTest) {
+	CharacterSections::SectionMap sections;
+	sections[std::string(CharacterSections::ROOT_SECTION)] = "<obj v=\"1\"/>";
+	sections["char"] = "<char cc=\"10\"/>";
+	sections["flag"] = "<flag/>";
+
+	ASSERT_EQ(CharacterSections::Join(sections), "<obj v=\"1\"><char cc=\"10\"/><flag/></obj>");
+}
+
+TEST(dCommonTests, CharacterSectionsInvalidXmlTest) {
+	tinyxml2::XMLDocument doc;
+	doc.Parse("<notobj/>");
+	ASSERT_TRUE(CharacterSections::Split(doc).empty());
+}
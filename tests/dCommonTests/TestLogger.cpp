@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Logger.h"
+
+namespace {
+	template<typename... Args>
+	std::string Format(const char* format, const Args&... args) {
+		LogArguments arguments;
+		(arguments.Add(args), ...);
+		std::string out;
+		Logger::FormatMessage(format, arguments.GetData(), arguments.GetSize(), out);
+		return out;
+	}
+
+	std::string Snprintf(const char* format, ...) {
+		char buffer[512];
+		va_list args;
+		va_start(args, format);
+		vsnprintf(buffer, sizeof(buffer), format, args);
+		va_end(args);
+		return buffer;
+	}
+
+	std::vector<std::string> ReadLines(const std::string& path) {
+		std::vector<std::string> lines;
+		std::ifstream file(path);
+		std::string line;
+		while (std::getline(file, line)) lines.push_back(line);
+		return lines;
+	}
+
+	enum class eTestEnum : uint8_t {
+		FIRST = 7
+	};
+}
+
+TEST(dCommonTests, LoggerFormatsLikePrintfTest) {
+	const int64_t objectId = 1152921504606846976;
+	const std::string name = "Buttercup";
+	const char* cName = "Brickmaster";
+
+	EXPECT_EQ(Format("%i %d %u", -5, 12, 40u), Snprintf("%i %d %u", -5, 12, 40u));
+	EXPECT_EQ(Format("%llu %lld %llx", objectId, objectId, objectId), Snprintf("%llu %lld %llx", objectId, objectId, objectId));
+	EXPECT_EQ(Format("%hhu %hd %x %X %o", 300, 70000, 255, 255, 8), Snprintf("%hhu %hd %x %X %o", (unsigned char)300, (short)70000, 255, 255, 8));
+	EXPECT_EQ(Format("%5.2f|%-8.3e|%g", 3.14159, 1234.5f, 0.0001), Snprintf("%5.2f|%-8.3e|%g", 3.14159, 1234.5, 0.0001));
+	EXPECT_EQ(Format("%s %-12s| %.4s %c", cName, name.c_str(), cName, 'x'), Snprintf("%s %-12s| %.4s %c", cName, name.c_str(), cName, 'x'));
+	EXPECT_EQ(Format("%*d|%-*.*f|", 6, 42, 9, 2, 1.5), Snprintf("%*d|%-*.*f|", 6, 42, 9, 2, 1.5));
+	EXPECT_EQ(Format("100%% of %zu %02i", sizeof(int64_t), 3), Snprintf("100%% of %zu %02i", sizeof(int64_t), 3));
+	EXPECT_EQ(Format("%i %s", eTestEnum::FIRST, name), "7 Buttercup");
+	EXPECT_EQ(Format("%i %s", 1), "1 (missing)");
+}
+
+TEST(dCommonTests, LoggerWritesMessagesOfEveryThreadTest) {
+	const std::string path = "./LoggerWritesMessagesOfEveryThreadTest.log";
+	constexpr uint32_t messagesPerThread = 500;
+	{
+		Logger logger(path, false, false);
+		std::vector<std::thread> threads;
+		for (uint32_t thread = 0; thread < 4; thread++) {
+			threads.emplace_back([&logger, thread]() {
+				for (uint32_t i = 0; i < messagesPerThread; i++) {
+					logger.Log("TestLogger.cpp:1", "thread %u message %u", thread, i);
+				}
+			});
+		}
+		for (auto& thread : threads) thread.join();
+
+		logger.LogDebug("TestLogger.cpp:2", "not written %i", 1);
+		logger.Flush();
+
+		ASSERT_EQ(logger.GetDroppedMessages(), 0);
+	}
+
+	const auto lines = ReadLines(path);
+	ASSERT_EQ(lines.size(), 4 * messagesPerThread);
+
+	// Messages of one thread keep their order
+	std::vector<uint32_t> nextMessage(4, 0);
+	for (const auto& line : lines) {
+		uint32_t thread = 0;
+		uint32_t message = 0;
+		const auto start = line.find("TestLogger.cpp:1] ");
+		ASSERT_NE(start, std::string::npos) << line;
+		ASSERT_EQ(sscanf(line.c_str() + start, "TestLogger.cpp:1] thread %u message %u", &thread, &message), 2) << line;
+		ASSERT_LT(thread, 4);
+		EXPECT_EQ(message, nextMessage[thread]++);
+	}
+}
+
+TEST(dCommonTests, LoggerFreesRingsOfExitedThreadsTest) {
+	const std::string path = "./LoggerFreesRingsOfExitedThreadsTest.log";
+	{
+		Logger logger(path, false, false);
+		std::vector<std::thread> threads;
+		for (uint32_t thread = 0; thread < 8; thread++) {
+			threads.emplace_back([&logger, thread]() { logger.Log("TestLogger.cpp:1", "thread %u", thread); });
+		}
+		for (auto& thread : threads) thread.join();
+
+		ASSERT_TRUE(logger.Flush());
+		ASSERT_EQ(logger.GetThreadRings(), 0);
+
+		logger.Log("TestLogger.cpp:2", "still logging");
+		ASSERT_EQ(logger.GetThreadRings(), 1);
+	}
+
+	ASSERT_EQ(ReadLines(path).size(), 9);
+}
+
+// Compares the time a thread spends logging with the synchronous logger this one replaced,
+// run with --gtest_also_run_disabled_tests --gtest_filter=*LoggerBenchmark*
+TEST(dCommonTests, DISABLED_LoggerBenchmarkTest) {
+	constexpr uint32_t messages = 200000;
+	const auto objectId = 1152921504606846976LL;
+
+	FILE* baselineFile = fopen("./LoggerBenchmarkBaseline.log", "wt");
+	ASSERT_NE(baselineFile, nullptr);
+	const auto baselineLog = [baselineFile](const char* className, const char* format, ...) {
+		std::string log = std::string(className) + "] " + std::string(format) + "\n";
+		time_t t = time(NULL);
+		struct tm* time = localtime(&t);
+		char timeStr[70];
+		strftime(timeStr, sizeof(timeStr), "[%d-%m-%y %H:%M:%S ", time);
+		char message[2048];
+		va_list args;
+		va_start(args, format);
+		vsnprintf(message, 2048, log.c_str(), args);
+		va_end(args);
+		fputs(timeStr, baselineFile);
+		fputs(message, baselineFile);
+	};
+
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < messages; i++) {
+		baselineLog("TestLogger.cpp:1", "Player %llu moved to %f %f %f in zone %i", objectId, 1.5f * i, 2.0, 3.0, 1100);
+	}
+	const auto baseline = std::chrono::steady_clock::now() - start;
+	fclose(baselineFile);
+
+	uint64_t dropped = 0;
+	std::chrono::steady_clock::duration async{};
+	std::chrono::steady_clock::duration flush{};
+	{
+		Logger logger("./LoggerBenchmark.log", false, false);
+		start = std::chrono::steady_clock::now();
+		for (uint32_t i = 0; i < messages; i++) {
+			logger.Log("TestLogger.cpp:1", "Player %llu moved to %f %f %f in zone %i", objectId, 1.5f * i, 2.0, 3.0, 1100);
+		}
+		async = std::chrono::steady_clock::now() - start;
+
+		start = std::chrono::steady_clock::now();
+		logger.Flush();
+		flush = std::chrono::steady_clock::now() - start;
+		dropped = logger.GetDroppedMessages();
+	}
+
+	const auto toNs = [](const std::chrono::steady_clock::duration duration) {
+		return std::chrono::duration<double, std::nano>(duration).count() / messages;
+	};
+	printf("Synchronous logger: %.1f ns per message\n", toNs(baseline));
+	printf("Asynchronous logger: %.1f ns per message on the logging thread, %.1f ns per message to flush, %llu dropped\n",
+		toNs(async), toNs(flush), static_cast<unsigned long long>(dropped));
+}
@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include "Metrics.hpp"
+
+TEST(dCommonTests, MetricsPercentileTest) {
+	Metrics::Clear();
+	ASSERT_EQ(Metrics::GetPercentile(MetricVariable::Frame, 0.5f), -1);
+
+	// Add the values out of order, 1 to 100
+	for (int64_t i = 0; i < 100; i++) {
+		Metrics::AddMeasurement(MetricVariable::Frame, (i * 37) % 100 + 1);
+	}
+
+	EXPECT_EQ(Metrics::GetPercentile(MetricVariable::Frame, 0.0f), 1);
+	EXPECT_EQ(Metrics::GetPercentile(MetricVariable::Frame, 0.5f), 51);
+	EXPECT_EQ(Metrics::GetPercentile(MetricVariable::Frame, 0.99f), 100);
+	EXPECT_EQ(Metrics::GetPercentile(MetricVariable::Frame, 1.0f), 100);
+
+	Metrics::Clear();
+}
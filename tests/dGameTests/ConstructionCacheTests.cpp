@@ -0,0 +1,103 @@
+#include "GameDependencies.h"
+#include <gtest/gtest.h>
+
+#include "BitStream.h"
+#include "DestroyableComponent.h"
+#include "Entity.h"
+#include "ModuleAssemblyComponent.h"
+#include "RenderComponent.h"
+#include "SimplePhysicsComponent.h"
+#include "eGameMasterLevel.h"
+#include "eStateChangeType.h"
+
+/**
+ * Every change to data that is only written on construction has to drop the cached construction,
+ * or players loading the entity later get the state it had when the cache was written.
+ */
+class ConstructionCacheTest : public GameDependenciesTest {
+protected:
+	std::unique_ptr<Entity> baseEntity;
+	std::unique_ptr<Entity> childEntity;
+
+	void SetUp() override {
+		SetUpDependencies();
+		baseEntity = std::make_unique<Entity>(15, GameDependenciesTest::info);
+		childEntity = std::make_unique<Entity>(16, GameDependenciesTest::info, nullptr, baseEntity.get());
+	}
+
+	void TearDown() override {
+		childEntity.reset();
+		baseEntity.reset();
+		TearDownDependencies();
+	}
+
+	void CacheConstruction() {
+		baseEntity->SetCachedConstruction(std::make_unique<RakNet::BitStream>());
+		ASSERT_NE(baseEntity->GetCachedConstruction(), nullptr);
+	}
+};
+
+TEST_F(ConstructionCacheTest, ParentChildInvalidates) {
+	CacheConstruction();
+	baseEntity->AddChild(childEntity.get());
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	CacheConstruction();
+	baseEntity->RemoveChild(childEntity.get());
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	childEntity->SetCachedConstruction(std::make_unique<RakNet::BitStream>());
+	childEntity->RemoveParent();
+	ASSERT_EQ(childEntity->GetCachedConstruction(), nullptr);
+}
+
+TEST_F(ConstructionCacheTest, GMLevelInvalidates) {
+	CacheConstruction();
+	baseEntity->SetGMLevel(eGameMasterLevel::DEVELOPER);
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+}
+
+TEST_F(ConstructionCacheTest, VarsInvalidate) {
+	CacheConstruction();
+	baseEntity->SetVar<std::string>(u"npcName", "Test");
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	CacheConstruction();
+	baseEntity->SetNetworkVar<int32_t>(u"test", 1);
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+}
+
+TEST_F(ConstructionCacheTest, RenderEffectsInvalidate) {
+	auto* renderComponent = baseEntity->AddComponent<RenderComponent>();
+
+	CacheConstruction();
+	renderComponent->AddEffect(1, "test", u"cast", 1.0f);
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	CacheConstruction();
+	renderComponent->RemoveEffect("test");
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	// Removing an effect that is not playing changes nothing
+	CacheConstruction();
+	renderComponent->RemoveEffect("test");
+	ASSERT_NE(baseEntity->GetCachedConstruction(), nullptr);
+}
+
+TEST_F(ConstructionCacheTest, ComponentSettersInvalidate) {
+	auto* destroyableComponent = baseEntity->AddComponent<DestroyableComponent>();
+	auto* simplePhysicsComponent = baseEntity->AddComponent<SimplePhysicsComponent>(1);
+	auto* moduleAssemblyComponent = baseEntity->AddComponent<ModuleAssemblyComponent>();
+
+	CacheConstruction();
+	destroyableComponent->SetStatusImmunity(eStateChangeType::PUSH, true, false, false, false, false, false, false, false, false);
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	CacheConstruction();
+	simplePhysicsComponent->SetClimbableType(eClimbableType::CLIMBABLE_TYPE_LADDER);
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+
+	CacheConstruction();
+	moduleAssemblyComponent->SetAssemblyPartsLOTs(u"1+2");
+	ASSERT_EQ(baseEntity->GetCachedConstruction(), nullptr);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "EntityManager.h"
+
+namespace {
+	// Sends every entity as a single byte and records the order they were sent in
+	struct ConstructionRecorder {
+		std::vector<std::pair<LWOOBJID, LWOOBJID>> constructed;
+		std::vector<LWOOBJID> drained;
+		std::vector<LWOOBJID> missing;
+
+		std::optional<uint32_t> Construct(const LWOOBJID player, const LWOOBJID entity) {
+			if (std::ranges::find(missing, entity) != missing.end()) return std::nullopt;
+			constructed.emplace_back(player, entity);
+			return 1;
+		}
+
+		void Send(EntityManager::ConstructionQueues& queues, const uint32_t budgetBytes) {
+			EntityManager::SendConstructions(queues, budgetBytes, 60.0f,
+				[this](const LWOOBJID player, const LWOOBJID entity) { return Construct(player, entity); },
+				[this](const LWOOBJID player) { drained.push_back(player); });
+		}
+
+		std::vector<LWOOBJID> ConstructedFor(const LWOOBJID player) const {
+			std::vector<LWOOBJID> entities;
+			for (const auto& [to, entity] : constructed) if (to == player) entities.push_back(entity);
+			return entities;
+		}
+	};
+}
+
+TEST(EntityManagerTests, OrderConstructionsImportantFirst) {
+	const auto queue = EntityManager::OrderConstructions({
+		{ 1, false, 10.0f },
+		{ 2, true, 400.0f },
+		{ 3, false, 1.0f },
+		{ 4, true, 4.0f },
+	});
+
+	// The next to construct is at the back
+	const std::vector<LWOOBJID> expected = { 1, 3, 2, 4 };
+	ASSERT_EQ(queue, expected);
+}
+
+TEST(EntityManagerTests, SendConstructionsSharesBudget) {
+	EntityManager::ConstructionQueues queues = {
+		{ 100, { 3, 2, 1 } },
+		{ 200, { 6, 5, 4 } },
+	};
+
+	// One construction per player per round, until the budget of two bytes is used up
+	ConstructionRecorder recorder;
+	recorder.Send(queues, 2);
+	ASSERT_EQ(recorder.ConstructedFor(100), std::vector<LWOOBJID>{ 1 });
+	ASSERT_EQ(recorder.ConstructedFor(200), std::vector<LWOOBJID>{ 4 });
+	ASSERT_TRUE(recorder.drained.empty());
+	ASSERT_EQ(queues.size(), 2);
+
+	// The next frame continues where the previous one stopped
+	recorder.Send(queues, 2);
+	ASSERT_EQ(recorder.ConstructedFor(100), (std::vector<LWOOBJID>{ 1, 2 }));
+	ASSERT_EQ(recorder.ConstructedFor(200), (std::vector<LWOOBJID>{ 4, 5 }));
+	ASSERT_TRUE(recorder.drained.empty());
+}
+
+TEST(EntityManagerTests, SendConstructionsDrainsOnlyOnceSent) {
+	EntityManager::ConstructionQueues queues = {
+		{ 100, { 2, 1 } },
+	};
+
+	ConstructionRecorder recorder;
+	recorder.Send(queues, 1);
+	ASSERT_EQ(recorder.ConstructedFor(100), std::vector<LWOOBJID>{ 1 });
+	ASSERT_TRUE(recorder.drained.empty());
+
+	// The player is only done after its last construction was sent
+	recorder.Send(queues, 1);
+	ASSERT_EQ(recorder.ConstructedFor(100), (std::vector<LWOOBJID>{ 1, 2 }));
+	ASSERT_EQ(recorder.drained, std::vector<LWOOBJID>{ 100 });
+	ASSERT_TRUE(queues.empty());
+}
+
+TEST(EntityManagerTests, SendConstructionsDrainsEmptyQueue) {
+	EntityManager::ConstructionQueues queues = {
+		{ 100, {} },
+	};
+
+	// A player without anything to construct is done right away
+	ConstructionRecorder recorder;
+	recorder.Send(queues, 1);
+	ASSERT_TRUE(recorder.constructed.empty());
+	ASSERT_EQ(recorder.drained, std::vector<LWOOBJID>{ 100 });
+	ASSERT_TRUE(queues.empty());
+}
+
+TEST(EntityManagerTests, SendConstructionsSkipsMissingEntities) {
+	EntityManager::ConstructionQueues queues = {
+		{ 100, { 3, 2, 1 } },
+	};
+
+	// A destroyed entity does not use up the player's turn or the budget
+	ConstructionRecorder recorder;
+	recorder.missing = { 1, 2 };
+	recorder.Send(queues, 1);
+	ASSERT_EQ(recorder.ConstructedFor(100), std::vector<LWOOBJID>{ 3 });
+	ASSERT_EQ(recorder.drained, std::vector<LWOOBJID>{ 100 });
+}
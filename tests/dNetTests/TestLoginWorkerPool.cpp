@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "LoginWorkerPool.h"
+
+namespace {
+	// Runs completions until count of them ran or a second passed
+	uint32_t WaitForCompletions(LoginWorkerPool& pool, const uint32_t count) {
+		uint32_t completed = 0;
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+		while (completed < count && std::chrono::steady_clock::now() < deadline) {
+			completed += pool.ProcessCompletedJobs();
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return completed;
+	}
+
+	// The finished callback runs after a job is published, so it may trail the completions
+	bool WaitForFinished(const std::atomic<uint32_t>& finished, const uint32_t count) {
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+		while (finished < count && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		return finished == count;
+	}
+}
+
+TEST(dNetTests, LoginWorkerPoolCompletesOnCallingThreadTest) {
+	std::atomic<uint32_t> finished = 0;
+	LoginWorkerPool pool(2, 8, [&finished]() { finished++; });
+
+	const auto mainThread = std::this_thread::get_id();
+	uint32_t successes = 0;
+	uint32_t failures = 0;
+	for (uint32_t i = 0; i < 4; i++) {
+		ASSERT_TRUE(pool.Submit([i]() { return i % 2 == 0; }, [&, mainThread](bool result) {
+			ASSERT_EQ(std::this_thread::get_id(), mainThread);
+			result ? successes++ : failures++;
+		}));
+	}
+
+	ASSERT_EQ(WaitForCompletions(pool, 4), 4);
+	ASSERT_EQ(successes, 2);
+	ASSERT_EQ(failures, 2);
+	ASSERT_TRUE(WaitForFinished(finished, 4));
+
+	const auto metrics = pool.GetMetrics();
+	ASSERT_EQ(metrics.queueDepth, 0);
+	ASSERT_EQ(metrics.completed, 4);
+	ASSERT_EQ(metrics.rejected, 0);
+}
+
+TEST(dNetTests, LoginWorkerPoolRejectsWhenFullTest) {
+	std::atomic<bool> release = false;
+	LoginWorkerPool pool(1, 2);
+
+	auto blockingWork = [&release]() {
+		while (!release) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		return true;
+	};
+
+	ASSERT_TRUE(pool.Submit(blockingWork, nullptr));
+	ASSERT_TRUE(pool.Submit(blockingWork, nullptr));
+	ASSERT_FALSE(pool.Submit(blockingWork, nullptr));
+
+	auto metrics = pool.GetMetrics(true);
+	ASSERT_EQ(metrics.queueDepth, 2);
+	ASSERT_EQ(metrics.peakQueueDepth, 2);
+	ASSERT_EQ(metrics.rejected, 1);
+
+	release = true;
+	ASSERT_EQ(WaitForCompletions(pool, 2), 2);
+	metrics = pool.GetMetrics();
+	ASSERT_EQ(metrics.queueDepth, 0);
+	ASSERT_EQ(metrics.completed, 2);
+}
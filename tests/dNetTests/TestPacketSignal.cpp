@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+#include "dServer.h"
+#include "Game.h"
+#include "Logger.h"
+#include "MessageIdentifiers.h"
+#include "PacketSignal.h"
+#include "RakNetworkFactory.h"
+#include "RakPeerInterface.h"
+
+namespace {
+	constexpr uint32_t packetCount = 300;
+
+	// Only bounds how long a broken test may hang, nothing is asserted against it
+	constexpr auto testTimeout = std::chrono::seconds(10);
+}
+
+class PacketSignalTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		m_Logger = std::make_unique<Logger>((std::filesystem::temp_directory_path() / "dNetTests.log").string(), false, false);
+		Game::logger = m_Logger.get();
+
+		// Port 0 binds a free port, so tests never collide with each other or a running server
+		m_Server = std::make_unique<dServer>("127.0.0.1", 0, 0, 4, true, false, m_Logger.get(), "", 0, ServerType::Master, nullptr, &m_Signal);
+		ASSERT_NE(m_Server->GetPort(), 0);
+	}
+
+	void TearDown() override {
+		if (m_Client) RakNetworkFactory::DestroyRakPeerInterface(m_Client);
+		m_Server.reset();
+		Game::logger = nullptr;
+		m_Logger.reset();
+	}
+
+	// Connects a client to the server, waiting for the connection with WaitForPackets
+	SystemAddress Connect() {
+		m_Client = RakNetworkFactory::GetRakPeerInterface();
+		SocketDescriptor clientSocket(0, "127.0.0.1");
+		EXPECT_TRUE(m_Client->Startup(1, 10, &clientSocket, 1));
+		EXPECT_TRUE(m_Client->Connect("127.0.0.1", m_Server->GetPort(), "3.25 DARKFLAME1", 15));
+
+		SystemAddress serverAddress = UNASSIGNED_SYSTEM_ADDRESS;
+		bool serverConnected = false;
+		const auto deadline = std::chrono::steady_clock::now() + testTimeout;
+		while ((serverAddress == UNASSIGNED_SYSTEM_ADDRESS || !serverConnected) && std::chrono::steady_clock::now() < deadline) {
+			Packet* packet = nullptr;
+			while ((packet = m_Client->Receive())) {
+				if (packet->data[0] == ID_CONNECTION_REQUEST_ACCEPTED) serverAddress = packet->systemAddress;
+				m_Client->DeallocatePacket(packet);
+			}
+			while ((packet = m_Server->Receive())) {
+				if (packet->data[0] == ID_NEW_INCOMING_CONNECTION) serverConnected = true;
+				m_Server->DeallocatePacket(packet);
+			}
+			m_Server->WaitForPackets(std::chrono::steady_clock::now() + std::chrono::milliseconds(10));
+		}
+
+		EXPECT_TRUE(serverConnected);
+		return serverAddress;
+	}
+
+	Game::signal_t m_Signal = 0;
+	std::unique_ptr<Logger> m_Logger;
+	std::unique_ptr<dServer> m_Server;
+	RakPeerInterface* m_Client = nullptr;
+};
+
+TEST(dNetTests, PacketSignalWaitUntilTest) {
+	PacketSignal signal;
+	ASSERT_FALSE(signal.WaitUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+
+	signal.OnPacketQueued(nullptr);
+	ASSERT_TRUE(signal.WaitUntil(std::chrono::steady_clock::now() + testTimeout));
+
+	// Every signal wakes a single wait
+	ASSERT_FALSE(signal.WaitUntil(std::chrono::steady_clock::now() + std::chrono::milliseconds(1)));
+}
+
+TEST_F(PacketSignalTest, WaitForPacketsWakeUpTest) {
+	std::thread waker([this]() { m_Server->WakeUp(); });
+	m_Server->WaitForPackets(std::chrono::steady_clock::now() + testTimeout);
+	waker.join();
+
+	ASSERT_EQ(m_Server->Receive(), nullptr);
+}
+
+TEST_F(PacketSignalTest, WaitForPacketsReceivesEveryPacketTest) {
+	const auto serverAddress = Connect();
+	ASSERT_NE(serverAddress, UNASSIGNED_SYSTEM_ADDRESS);
+
+	for (uint32_t i = 0; i < packetCount; i++) {
+		const unsigned char data[] = { ID_USER_PACKET_ENUM, static_cast<unsigned char>(i) };
+		m_Client->Send(reinterpret_cast<const char*>(data), sizeof(data), HIGH_PRIORITY, RELIABLE_ORDERED, 0, serverAddress, false);
+	}
+
+	// Drained the way the servers do, every packet in order, waking up for new ones
+	uint32_t received = 0;
+	const auto deadline = std::chrono::steady_clock::now() + testTimeout;
+	while (received < packetCount && std::chrono::steady_clock::now() < deadline) {
+		m_Server->WaitForPackets(deadline);
+
+		Packet* packet = nullptr;
+		while ((packet = m_Server->Receive())) {
+			if (packet->data[0] == ID_USER_PACKET_ENUM) {
+				EXPECT_EQ(packet->data[1], static_cast<unsigned char>(received));
+				received++;
+			}
+			m_Server->DeallocatePacket(packet);
+		}
+	}
+
+	ASSERT_EQ(received, packetCount);
+}
+
+TEST_F(PacketSignalTest, DISABLED_PacketThroughputBenchmarkTest) {
+	constexpr uint32_t packets = 20000;
+	// The chat, auth and master servers used to handle one packet per 33ms frame
+	constexpr double framePolledPacketsPerSecond = 1000.0 / 33.0;
+
+	const auto serverAddress = Connect();
+	ASSERT_NE(serverAddress, UNASSIGNED_SYSTEM_ADDRESS);
+
+	const auto start = std::chrono::steady_clock::now();
+	std::thread sender([this, serverAddress]() {
+		for (uint32_t i = 0; i < packets; i++) {
+			const unsigned char data[] = { ID_USER_PACKET_ENUM, static_cast<unsigned char>(i) };
+			m_Client->Send(reinterpret_cast<const char*>(data), sizeof(data), HIGH_PRIORITY, RELIABLE_ORDERED, 0, serverAddress, false);
+		}
+	});
+
+	uint32_t received = 0;
+	uint32_t wakeUps = 0;
+	const auto deadline = std::chrono::steady_clock::now() + testTimeout;
+	while (received < packets && std::chrono::steady_clock::now() < deadline) {
+		m_Server->WaitForPackets(deadline);
+		wakeUps++;
+
+		Packet* packet = nullptr;
+		while ((packet = m_Server->Receive())) {
+			if (packet->data[0] == ID_USER_PACKET_ENUM) received++;
+			m_Server->DeallocatePacket(packet);
+		}
+	}
+	const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	sender.join();
+
+	ASSERT_EQ(received, packets);
+	printf("Drained %u packets in %.3fs over %u wake ups: %.0f packets per second, one packet per frame would handle %.0f\n",
+		packets, elapsed, wakeUps, packets / elapsed, framePolledPacketsPerSecond);
+}
@@ -0,0 +1,7 @@
+#include "Game.h"
+
+class Logger;
+namespace Game
+{
+	Logger* logger;
+} // namespace Game
@@ -252,6 +252,7 @@ public:
     void bind(int nParam, const char* szValue);
     void bind(int nParam, const int nValue);
     void bind(int nParam, const double dwValue);
+    void bind(int nParam, const sqlite_int64 nValue);
     void bind(int nParam, const unsigned char* blobValue, int nLen);
     void bindNull(int nParam);
 
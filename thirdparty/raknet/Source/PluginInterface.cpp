@@ -79,6 +79,10 @@ void PluginInterface::OnInternalPacket(InternalPacket *internalPacket, unsigned
 	(void) time;
 	(void) isSend;
 }
+void PluginInterface::OnPacketQueued(RakPeerInterface *peer)
+{
+	(void) peer;
+}
 
 #ifdef _MSC_VER
 #pragma warning( pop )
@@ -105,6 +105,10 @@ public:
 	/// \param[in] time The current time as returned by RakNet::GetTime()
 	/// \param[in] isSend Is this callback representing a send event or receive event?
 	virtual void OnInternalPacket(InternalPacket *internalPacket, unsigned frameNumber, SystemAddress remoteSystemAddress, RakNetTime time, bool isSend);
+
+	/// Called whenever a packet was queued for Receive, usually from the network thread
+	/// \param[in] peer the instance of RakPeer that queued the packet
+	virtual void OnPacketQueued(RakPeerInterface *peer);
 };
 
 #endif
@@ -3983,6 +3983,9 @@ inline void RakPeer::AddPacketToProducer(Packet *p)
 	Packet **packetPtr=packetSingleProducerConsumer.WriteLock();
 	*packetPtr=p;
 	packetSingleProducerConsumer.WriteUnlock();
+
+	for (unsigned i=0; i < messageHandlerList.Size(); i++)
+		messageHandlerList[i]->OnPacketQueued(this);
 }
 // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 void ProcessPortUnreachable( unsigned int binaryAddress, unsigned short port, RakPeer *rakPeer )